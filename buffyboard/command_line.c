@@ -105,6 +105,11 @@ static void print_usage() {
         "                            * 2 - upside down orientation (180 degrees)\n"
         "                            * 3 - counterclockwise orientation (270 degrees)\n"
         "  -h, --help                Print this message and exit\n"
+        "      --record-input=PATH   Record all input events to PATH\n"
+        "      --replay-input=PATH   Replay the input events recorded in PATH instead\n"
+        "                            of using input devices and exit afterwards\n"
+        "      --replay-fast         Replay input events as fast as possible instead\n"
+        "                            of in real time, redrawing after each of them\n"
         "  -v, --verbose             Enable more detailed logging output on STDERR\n"
         "  -V, --version             Print the buffyboard version and exit\n");
         /*-------------------------------- 78 CHARS --------------------------------*/
@@ -126,6 +131,9 @@ void bb_cli_parse_opts(int argc, char *argv[], bb_cli_opts *opts) {
         { "help",            no_argument,       NULL, 'h' },
         { "verbose",         no_argument,       NULL, 'v' },
         { "version",         no_argument,       NULL, 'V' },
+        { "record-input",    required_argument, NULL, BBX_CLI_OPT_RECORD_INPUT },
+        { "replay-input",    required_argument, NULL, BBX_CLI_OPT_REPLAY_INPUT },
+        { "replay-fast",     no_argument,       NULL, BBX_CLI_OPT_REPLAY_FAST },
         { NULL, 0, NULL, 0 }
     };
 
@@ -183,6 +191,15 @@ void bb_cli_parse_opts(int argc, char *argv[], bb_cli_opts *opts) {
         case 'V':
             bbx_cli_print_version_and_exit("unl0kr");
             break;
+        case BBX_CLI_OPT_RECORD_INPUT:
+            opts->common.record_input = optarg;
+            break;
+        case BBX_CLI_OPT_REPLAY_INPUT:
+            opts->common.replay_input = optarg;
+            break;
+        case BBX_CLI_OPT_REPLAY_FAST:
+            opts->common.replay_fast = true;
+            break;
         default:
             print_usage();
             exit(EXIT_FAILURE);
@@ -12,9 +12,10 @@
 
 #include "lvgl/lvgl.h"
 
+#include <errno.h>
 #include <ini.h>
+#include <limits.h>
 #include <stdlib.h>
-#include <string.h>
 
 
 /**
@@ -32,42 +33,54 @@
  */
 static int parsing_handler(void* user_data, const char* section, const char* key, const char* value);
 
+/**
+ * Parse a non-negative integer option value.
+ *
+ * @param value string to parse
+ * @param result pointer to an int to write the result into if parsing is successful
+ * @return true on success, false otherwise
+ */
+static bool parse_non_negative_int(const char *value, void *result);
+
+
+/**
+ * Static variables
+ */
+
+#define OPTION(section, key, parse, member) BBX_CONFIG_OPTION(section, key, parse, bb_config_opts, member)
+
+/* Keep sorted by section and then by key */
+static const bbx_config_option options[] = {
+    OPTION("input", "pointer", bbx_config_parse_bool_option, input.pointer),
+    OPTION("input", "touchscreen", bbx_config_parse_bool_option, input.touchscreen),
+    OPTION("keyboard", "repeat_delay", parse_non_negative_int, keyboard.repeat_delay),
+    OPTION("keyboard", "repeat_rate", parse_non_negative_int, keyboard.repeat_rate),
+    OPTION("quirks", "fbdev_force_refresh", bbx_config_parse_bool_option, quirks.fbdev_force_refresh),
+    OPTION("quirks", "ignore_unused_terminals", bbx_config_parse_bool_option, quirks.ignore_unused_terminals),
+    OPTION("theme", "default", bbx_config_parse_theme_option, theme.default_id),
+};
+
+static const bbx_config_schema schema = { options, sizeof(options) / sizeof(options[0]) };
+
 
 /**
  * Static functions
  */
 
+static bool parse_non_negative_int(const char *value, void *result) {
+    char *end = NULL;
+    errno = 0;
+    long number = strtol(value, &end, 10);
+    if (errno != 0 || end == value || *end != '\0' || number < 0 || number > INT_MAX) {
+        return false;
+    }
+    *(int *)result = (int)number;
+    return true;
+}
+
 static int parsing_handler(void* user_data, const char* section, const char* key, const char* value) {
-    bb_config_opts *opts = (bb_config_opts *)user_data;
-
-    if (strcmp(section, "theme") == 0) {
-        if (strcmp(key, "default") == 0) {
-            bbx_themes_theme_id_t id = bbx_themes_find_theme_with_name(value);
-            if (id != BBX_THEMES_THEME_NONE) {
-                opts->theme.default_id = id;
-                return 1;
-            }
-        }
-    } else if (strcmp(section, "input") == 0) {
-        if (strcmp(key, "pointer") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->input.pointer))) {
-                return 1;
-            }
-        } else if (strcmp(key, "touchscreen") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->input.touchscreen))) {
-                return 1;
-            }
-        }
-    } else if (strcmp(section, "quirks") == 0) {
-        if (strcmp(key, "fbdev_force_refresh") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->quirks.fbdev_force_refresh))) {
-                return 1;
-            }
-        } else if (strcmp(key, "ignore_unused_terminals") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->quirks.ignore_unused_terminals))) {
-                return 1;
-            }
-        }
+    if (bbx_config_apply_option(&schema, user_data, section, key, value)) {
+        return 1;
     }
 
     bbx_log(BBX_LOG_LEVEL_ERROR, "Ignoring invalid config value \"%s\" for key \"%s\" in section \"%s\"", value, key, section);
@@ -80,7 +93,11 @@ static int parsing_handler(void* user_data, const char* section, const char* key
  */
 
 void bb_config_init_opts(bb_config_opts *opts) {
+    bbx_config_check_schemas(&schema, NULL);
+
     opts->theme.default_id = BBX_THEMES_THEME_BREEZY_DARK;
+    opts->keyboard.repeat_delay = 500;
+    opts->keyboard.repeat_rate = 30;
     opts->input.pointer = true;
     opts->input.touchscreen = true;
     opts->quirks.fbdev_force_refresh = false;
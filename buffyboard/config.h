@@ -19,6 +19,16 @@ typedef struct {
     bbx_themes_theme_id_t default_id;
 } bb_config_opts_theme;
 
+/**
+ * Options related to the keyboard
+ */
+typedef struct {
+    /* Delay in milliseconds before a held key starts repeating */
+    int repeat_delay;
+    /* Number of repeats per second of a held key, 0 to disable repeating */
+    int repeat_rate;
+} bb_config_opts_keyboard;
+
 /**
  * Options related to input devices
  */
@@ -45,6 +55,8 @@ typedef struct {
 typedef struct {
     /* Options related to the theme */
     bb_config_opts_theme theme;
+    /* Options related to the keyboard */
+    bb_config_opts_keyboard keyboard;
     /* Options related to input devices */
     bb_config_opts_input input;
     /* Options related to (normally unneeded) quirks */
@@ -12,6 +12,7 @@
 
 #include "lvgl/lvgl.h"
 
+#include "../shared/draw_threads.h"
 #include "../shared/indev.h"
 #include "../shared/log.h"
 #include "../shared/theme.h"
@@ -19,11 +20,13 @@
 #include "../squeek2lvgl/sq2lv.h"
 
 #include <sys/epoll.h>
+#include <sys/inotify.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
 
@@ -38,6 +41,25 @@ static int fd_active;
 static lv_obj_t *keyboard = NULL;
 static sig_atomic_t redraw_requested = false;
 
+/* Scancodes of the key that is held down and repeated by the kernel */
+static uint16_t held_btn_id = LV_BUTTONMATRIX_BUTTON_NONE;
+static const int *held_scancodes = NULL;
+static int num_held_scancodes = 0;
+
+/* Configuration files and directories, parsed pairwise in this order before any files from the command line */
+static const char *config_files[] = { "/usr/share/buffyboard/buffyboard.conf", "/etc/buffyboard.conf" };
+static const char *config_dirs[] = { "/usr/share/buffyboard/buffyboard.conf.d", "/etc/buffyboard.conf.d" };
+#define NUM_CONFIG_LOCATIONS (sizeof(config_files) / sizeof(config_files[0]))
+
+typedef struct {
+    int wd;
+    char *path;
+} config_watch;
+
+static int fd_config_inotify = -1;
+static config_watch *config_watches = NULL;
+static int num_config_watches = 0;
+
 /**
  * Static prototypes
  */
@@ -49,6 +71,11 @@ static sig_atomic_t redraw_requested = false;
  */
 static void signal_handler(int signum);
 
+/**
+ * Reset the terminals and exit once a replayed input trace has ended.
+ */
+static void replay_finished(void);
+
 /**
  * Handle LV_EVENT_VALUE_CHANGED events from the keyboard widget.
  * 
@@ -56,6 +83,33 @@ static void signal_handler(int signum);
  */
 static void keyboard_value_changed_cb(lv_event_t *event);
 
+/**
+ * Handle LV_EVENT_PRESSED and LV_EVENT_PRESSING events from the keyboard widget.
+ *
+ * @param event the event object
+ */
+static void keyboard_pressed_cb(lv_event_t *event);
+
+/**
+ * Handle LV_EVENT_RELEASED and LV_EVENT_PRESS_LOST events from the keyboard widget.
+ *
+ * @param event the event object
+ */
+static void keyboard_released_cb(lv_event_t *event);
+
+/**
+ * Check whether a key is held down while pressed (and repeated by the kernel) instead of being clicked.
+ *
+ * @param btn_id button index corresponding to the key
+ * @return true if the key is held down while pressed, false otherwise
+ */
+static bool is_repeatable_key(uint16_t btn_id);
+
+/**
+ * Emit key up events for the held key, if any.
+ */
+static void release_held_key(void);
+
 /**
  * Emit key down and up events for a key.
  *
@@ -70,6 +124,70 @@ static void emit_key_events(uint16_t btn_id, bool key_down, bool key_up);
  */
 static void pop_checked_modifier_keys(void);
 
+/**
+ * Apply the autorepeat options to the uinput device.
+ *
+ * @param opts pointer to the options to apply
+ */
+static void set_repeat(const bb_config_opts *opts);
+
+/**
+ * Parse all configuration files.
+ *
+ * @param opts pointer for writing the parsed options into
+ */
+static void parse_config(bb_config_opts *opts);
+
+/**
+ * Check whether a file in a directory is the given file path.
+ *
+ * @param dir directory of the file
+ * @param name name of the file
+ * @param path file path to compare to
+ * @return true if dir and name refer to path, false otherwise
+ */
+static bool is_same_path(const char *dir, const char *name, const char *path);
+
+/**
+ * Check whether a file in a watched directory affects the configuration.
+ *
+ * @param dir directory of the file
+ * @param name name of the file
+ * @return true if the file is a configuration file, false otherwise
+ */
+static bool is_config_file(const char *dir, const char *name);
+
+/**
+ * Start watching a directory for configuration changes. Missing directories are skipped.
+ *
+ * @param path directory path
+ */
+static void add_config_watch(const char *path);
+
+/**
+ * Start watching the directory that contains a file for configuration changes.
+ *
+ * @param path file path
+ */
+static void add_config_watch_for_file(const char *path);
+
+/**
+ * Set up watching the configuration files and directories for changes.
+ *
+ * @param fd_epoll epoll descriptor to add the watch to
+ */
+static void watch_config(int fd_epoll);
+
+/**
+ * Handle changes in watched configuration directories.
+ */
+static void on_config_event();
+
+/**
+ * Reparse the configuration and apply the options that changed.
+ */
+static void reload_config(void);
+
 
 /**
  * Static functions
@@ -85,6 +203,11 @@ static void signal_handler(int signum) {
     exit(0);
 }
 
+static void replay_finished(void) {
+    bb_terminal_reset_all();
+    exit(0);
+}
+
 static void keyboard_value_changed_cb(lv_event_t *event) {
     lv_obj_t *kb = lv_event_get_target(event);
 
@@ -99,6 +222,11 @@ static void keyboard_value_changed_cb(lv_event_t *event) {
         return;
     }
 
+    /* Repeatable keys are pressed and released by keyboard_pressed_cb and keyboard_released_cb */
+    if (is_repeatable_key(btn_id)) {
+        return;
+    }
+
     /* Note that the LV_BUTTONMATRIX_CTRL_CHECKED logic is inverted because LV_KEYBOARD_CTRL_BTN_FLAGS already
      * contains LV_BUTTONMATRIX_CTRL_CHECKED. As a result, pressing e.g. CTRL will _un_check the key. To account
      * for this, we invert the meaning of "checked" here and elsewhere in the code. */
@@ -116,6 +244,58 @@ static void keyboard_value_changed_cb(lv_event_t *event) {
     }
 }
 
+static void keyboard_pressed_cb(lv_event_t *event) {
+    LV_UNUSED(event);
+
+    uint16_t btn_id = lv_buttonmatrix_get_selected_button(keyboard);
+    if (btn_id == held_btn_id) {
+        return;
+    }
+
+    /* The pointer moved to another key */
+    release_held_key();
+
+    if (btn_id == LV_BUTTONMATRIX_BUTTON_NONE || !is_repeatable_key(btn_id)) {
+        return;
+    }
+
+    /* Only emit key down events. The kernel repeats the key until it is released. */
+    held_btn_id = btn_id;
+    held_scancodes = sq2lv_get_scancodes(keyboard, btn_id, &num_held_scancodes);
+    for (int i = 0; i < num_held_scancodes; ++i) {
+        bb_uinput_device_emit_key_down(held_scancodes[i]);
+    }
+}
+
+static void keyboard_released_cb(lv_event_t *event) {
+    LV_UNUSED(event);
+    release_held_key();
+}
+
+static bool is_repeatable_key(uint16_t btn_id) {
+    return !lv_buttonmatrix_has_button_ctrl(keyboard, btn_id, LV_BUTTONMATRIX_CTRL_NO_REPEAT)
+        && !sq2lv_is_modifier(keyboard, btn_id)
+        && !sq2lv_is_layer_switcher(keyboard, btn_id);
+}
+
+static void release_held_key(void) {
+    if (held_btn_id == LV_BUTTONMATRIX_BUTTON_NONE) {
+        return;
+    }
+
+    /* Emit key up events in backward order */
+    for (int i = num_held_scancodes - 1; i >= 0; --i) {
+        bb_uinput_device_emit_key_up(held_scancodes[i]);
+    }
+
+    held_btn_id = LV_BUTTONMATRIX_BUTTON_NONE;
+    held_scancodes = NULL;
+    num_held_scancodes = 0;
+
+    /* Pop any previously checked modifiers like after any other non-modifier key */
+    pop_checked_modifier_keys();
+}
+
 static void emit_key_events(uint16_t btn_id, bool key_down, bool key_up) {
     int num_scancodes = 0;
     const int *scancodes = sq2lv_get_scancodes(keyboard, btn_id, &num_scancodes);
@@ -177,6 +357,213 @@ static void on_new_terminal() {
     lv_obj_invalidate(keyboard);
 }
 
+static void set_repeat(const bb_config_opts *opts) {
+    int period = opts->keyboard.repeat_rate > 0 ? LV_MAX(1000 / opts->keyboard.repeat_rate, 1) : 0;
+    if (!bb_uinput_device_set_repeat(opts->keyboard.repeat_delay, period)) {
+        bbx_log(BBX_LOG_LEVEL_WARNING, "Could not configure key repeat");
+    }
+}
+
+static void parse_config(bb_config_opts *opts) {
+    bb_config_init_opts(opts);
+    for (size_t i = 0; i < NUM_CONFIG_LOCATIONS; ++i) {
+        bb_config_parse_file(config_files[i], opts);
+        bb_config_parse_directory(config_dirs[i], opts);
+    }
+    bb_config_parse_files(cli_opts.config_files, cli_opts.num_config_files, opts);
+}
+
+static bool is_same_path(const char *dir, const char *name, const char *path) {
+    const char *slash = strrchr(path, '/');
+    if (!slash) {
+        return strcmp(dir, ".") == 0 && strcmp(name, path) == 0;
+    }
+
+    size_t dir_length = slash == path ? 1 : (size_t)(slash - path);
+    return strlen(dir) == dir_length && strncmp(dir, path, dir_length) == 0 && strcmp(name, slash + 1) == 0;
+}
+
+static bool is_config_file(const char *dir, const char *name) {
+    for (size_t i = 0; i < NUM_CONFIG_LOCATIONS; ++i) {
+        if (is_same_path(dir, name, config_files[i])) {
+            return true;
+        }
+
+        size_t name_length = strlen(name);
+        if (strcmp(dir, config_dirs[i]) == 0 && name_length > 5 && strcmp(name + name_length - 5, ".conf") == 0) {
+            return true;
+        }
+    }
+
+    for (int i = 0; i < cli_opts.num_config_files; ++i) {
+        if (is_same_path(dir, name, cli_opts.config_files[i])) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void add_config_watch(const char *path) {
+    int wd = inotify_add_watch(fd_config_inotify, path,
+        IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_CREATE | IN_ONLYDIR);
+    if (wd < 0) {
+        if (errno != ENOENT) {
+            bbx_log(BBX_LOG_LEVEL_WARNING, "Could not watch %s for configuration changes: %s", path, strerror(errno));
+        }
+        return;
+    }
+
+    /* Several files can share a directory */
+    for (int i = 0; i < num_config_watches; ++i) {
+        if (config_watches[i].wd == wd) {
+            return;
+        }
+    }
+
+    config_watch *tmp = realloc(config_watches, (num_config_watches + 1) * sizeof(config_watch));
+    char *watch_path = strdup(path);
+    if (!tmp || !watch_path) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for configuration watch");
+        if (tmp) {
+            config_watches = tmp;
+        }
+        free(watch_path);
+        inotify_rm_watch(fd_config_inotify, wd);
+        return;
+    }
+
+    config_watches = tmp;
+    config_watches[num_config_watches].wd = wd;
+    config_watches[num_config_watches].path = watch_path;
+    num_config_watches++;
+}
+
+static void add_config_watch_for_file(const char *path) {
+    const char *slash = strrchr(path, '/');
+    if (!slash) {
+        add_config_watch(".");
+        return;
+    }
+
+    size_t dir_length = slash == path ? 1 : (size_t)(slash - path);
+    char dir[dir_length + 1];
+    memcpy(dir, path, dir_length);
+    dir[dir_length] = '\0';
+    add_config_watch(dir);
+}
+
+static void watch_config(int fd_epoll) {
+    fd_config_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd_config_inotify < 0) {
+        bbx_log(BBX_LOG_LEVEL_WARNING, "Could not watch configuration files: %s", strerror(errno));
+        return;
+    }
+
+    /* Watch the parents as well to pick up configuration files and directories that are created later */
+    for (size_t i = 0; i < NUM_CONFIG_LOCATIONS; ++i) {
+        add_config_watch_for_file(config_files[i]);
+        add_config_watch(config_dirs[i]);
+    }
+    for (int i = 0; i < cli_opts.num_config_files; ++i) {
+        add_config_watch_for_file(cli_opts.config_files[i]);
+    }
+
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = __extension__ (void*) on_config_event;
+
+    if (epoll_ctl(fd_epoll, EPOLL_CTL_ADD, fd_config_inotify, &event) == -1) {
+        bbx_log(BBX_LOG_LEVEL_WARNING, "EPOLL_CTL_ADD for configuration watch is failed");
+    }
+}
+
+static void on_config_event() {
+    uint8_t buffer[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+    bool changed = false;
+
+    /* Drain all pending events first so that a burst of writes results in a single reload */
+    ssize_t size;
+    while ((size = read(fd_config_inotify, buffer, sizeof(buffer))) > 0) {
+        for (uint8_t *p = buffer; p < buffer + size; ) {
+            const struct inotify_event *event = (const struct inotify_event *)p;
+            p += sizeof(struct inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                changed = true;
+                continue;
+            }
+
+            if (event->len == 0) {
+                continue;
+            }
+
+            const char *dir = NULL;
+            for (int i = 0; i < num_config_watches; ++i) {
+                if (config_watches[i].wd == event->wd) {
+                    dir = config_watches[i].path;
+                    break;
+                }
+            }
+            if (!dir) {
+                continue;
+            }
+
+            if (event->mask & IN_ISDIR) {
+                /* A configuration directory appeared or went away */
+                for (size_t i = 0; i < NUM_CONFIG_LOCATIONS; ++i) {
+                    if (is_same_path(dir, event->name, config_dirs[i])) {
+                        if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                            add_config_watch(config_dirs[i]);
+                        }
+                        changed = true;
+                    }
+                }
+                continue;
+            }
+
+            /* Files are only complete once they are closed or moved into place */
+            if (!(event->mask & IN_CREATE) && is_config_file(dir, event->name)) {
+                changed = true;
+            }
+        }
+    }
+
+    if (changed) {
+        reload_config();
+    }
+}
+
+static void reload_config(void) {
+    bb_config_opts opts;
+    parse_config(&opts);
+
+    bbx_log(BBX_LOG_LEVEL_VERBOSE, "Configuration changed, applying");
+
+    if (opts.theme.default_id != conf_opts.theme.default_id) {
+        bbx_theme_apply(bbx_themes_themes[opts.theme.default_id]);
+    }
+
+    if (opts.input.pointer != conf_opts.input.pointer || opts.input.touchscreen != conf_opts.input.touchscreen) {
+        struct bbx_indev_opts input_config = {
+            .pointer = opts.input.pointer,
+            .touchscreen = opts.input.touchscreen
+        };
+        bbx_indev_set_filters(&input_config);
+    }
+
+    if (opts.keyboard.repeat_delay != conf_opts.keyboard.repeat_delay || opts.keyboard.repeat_rate != conf_opts.keyboard.repeat_rate) {
+        set_repeat(&opts);
+    }
+
+    if (opts.quirks.fbdev_force_refresh != conf_opts.quirks.fbdev_force_refresh) {
+        lv_linux_fbdev_set_force_refresh(lv_display_get_default(), opts.quirks.fbdev_force_refresh);
+    }
+
+    /* Remaining options are read when they are used */
+    conf_opts = opts;
+}
+
 /**
  * Main
  */
@@ -191,20 +578,16 @@ int main(int argc, char *argv[]) {
     }
 
     /* Parse config files */
-    bb_config_init_opts(&conf_opts);
-    bb_config_parse_file("/usr/share/buffyboard/buffyboard.conf", &conf_opts);
-    bb_config_parse_directory("/usr/share/buffyboard/buffyboard.conf.d", &conf_opts);
-    bb_config_parse_file("/etc/buffyboard.conf", &conf_opts);
-    bb_config_parse_directory("/etc/buffyboard.conf.d", &conf_opts);
-    bb_config_parse_files(cli_opts.config_files, cli_opts.num_config_files, &conf_opts);
+    parse_config(&conf_opts);
 
     /* Set up uinput device */
     if (!bb_uinput_device_init(sq2lv_unique_scancodes, sq2lv_num_unique_scancodes)) {
         return EXIT_FAILURE;
     }
+    set_repeat(&conf_opts);
 
     /* Initialise LVGL and set up logging callback */
-    lv_init();
+    bbx_draw_threads_init_lvgl();
     lv_log_register_print_cb(bbx_log_print_cb);
 
     /* Initialise display */
@@ -214,6 +597,17 @@ int main(int argc, char *argv[]) {
         return EXIT_FAILURE;
     }
     lv_linux_fbdev_set_file(disp, "/dev/fb0");
+
+    /* LVGL renders in the framebuffer's native format, which it derives from the bits per pixel */
+#if !LV_DRAW_SW_SUPPORT_RGB565
+    if (lv_display_get_color_format(disp) == LV_COLOR_FORMAT_RGB565) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "/dev/fb0 uses 16 bits per pixel but RGB565 support is disabled in this build");
+        return EXIT_FAILURE;
+    }
+#endif /* !LV_DRAW_SW_SUPPORT_RGB565 */
+    bbx_log(BBX_LOG_LEVEL_VERBOSE, "Rendering with %d bits per pixel",
+        lv_color_format_get_bpp(lv_display_get_color_format(disp)));
+
     if (conf_opts.quirks.fbdev_force_refresh) {
         lv_linux_fbdev_set_force_refresh(disp, true);
     }
@@ -268,6 +662,10 @@ int main(int argc, char *argv[]) {
         }
     }
     lv_obj_add_event_cb(keyboard, keyboard_value_changed_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_obj_add_event_cb(keyboard, keyboard_pressed_cb, LV_EVENT_PRESSED, NULL);
+    lv_obj_add_event_cb(keyboard, keyboard_pressed_cb, LV_EVENT_PRESSING, NULL);
+    lv_obj_add_event_cb(keyboard, keyboard_released_cb, LV_EVENT_RELEASED, NULL);
+    lv_obj_add_event_cb(keyboard, keyboard_released_cb, LV_EVENT_PRESS_LOST, NULL);
     lv_obj_set_pos(keyboard, 0, 0);
     lv_obj_set_size(keyboard, LV_HOR_RES, LV_VER_RES);
     bbx_theme_prepare_keyboard(keyboard);
@@ -301,11 +699,19 @@ int main(int argc, char *argv[]) {
     /* Attach input devices and start monitoring for new ones */
     struct bbx_indev_opts input_config = {
         .pointer = conf_opts.input.pointer,
-        .touchscreen = conf_opts.input.touchscreen
+        .touchscreen = conf_opts.input.touchscreen,
+        .record_path = cli_opts.common.record_input,
+        .replay_path = cli_opts.common.replay_input,
+        .replay_fast = cli_opts.common.replay_fast
     };
     if (bbx_indev_init(fd_epoll, &input_config) == 0)
         return EXIT_FAILURE;
 
+    bbx_indev_set_replay_finished_cb(replay_finished);
+
+    /* Apply configuration changes without restarting (and recreating the uinput device) */
+    watch_config(fd_epoll);
+
     /* Set signal handlers */
     struct sigaction action;
     action.sa_handler = signal_handler;
@@ -3,12 +3,23 @@
 # Copyright 2021 Johannes Marbach
 # SPDX-License-Identifier: GPL-3.0-or-later
 
+# Additional arguments (e.g. --squeekboard-dir and --cache-dir) are passed on to squeek2lvgl.py. Set
+# SQ2LV_PYTHON to a Python interpreter with PyYAML installed to skip pipenv.
 
-cd ../squeek2lvgl
-pipenv install
-pipenv run python squeek2lvgl.py \
+
+cd "$(dirname "${BASH_SOURCE[0]}")/../squeek2lvgl"
+
+if [ -n "$SQ2LV_PYTHON" ]; then
+    squeek2lvgl=("$SQ2LV_PYTHON" squeek2lvgl.py)
+else
+    pipenv install
+    squeek2lvgl=(pipenv run python squeek2lvgl.py)
+fi
+
+"${squeek2lvgl[@]}" \
     --input terminal/us.yaml \
         --name "US English (Terminal)" \
     --output ../buffyboard \
     --generate-scancodes \
-    --shift-keycap '\xef\x8d\x9b'
+    --shift-keycap '\xef\x8d\x9b' \
+    "$@"
@@ -43,15 +43,15 @@ static const int modifier_idxs_lower_terminal_us[] = { \
 
 static const int num_switchers_lower_terminal_us = 3;
 
-static const int switcher_idxs_lower_terminal_us[] = { \
+static const uint16_t switcher_idxs_lower_terminal_us[] = { \
     25, 34, 36 \
 };
 
-static const int switcher_dests_lower_terminal_us[] = { \
+static const uint16_t switcher_dests_lower_terminal_us[] = { \
     1, 2, 4 \
 };
 
-static const int num_scancodes_lower_terminal_us = 5;
+static const int num_scancodes_lower_terminal_us = 35;
 
 static const int scancodes_lower_terminal_us[] = { \
     KEY_LEFTCTRL, KEY_LEFTALT, KEY_UP, KEY_DOWN, KEY_LEFT, KEY_RIGHT, \
@@ -61,7 +61,7 @@ static const int scancodes_lower_terminal_us[] = { \
     KEY_SPACE, KEY_ENTER \
 };
 
-static const int scancode_idxs_lower_terminal_us[] = { \
+static const int16_t scancode_idxs_lower_terminal_us[] = { \
     0, 1, 2, 3, 4, 5, \
     6, 7, 8, 9, 10, 11, 12, 13, 14, 15, \
     16, 17, 18, 19, 20, 21, 22, 23, 24, \
@@ -69,7 +69,7 @@ static const int scancode_idxs_lower_terminal_us[] = { \
     -1, 33, -1, 34 \
 };
 
-static const int scancode_nums_lower_terminal_us[] = { \
+static const uint16_t scancode_nums_lower_terminal_us[] = { \
     1, 1, 1, 1, 1, 1, \
     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, \
     1, 1, 1, 1, 1, 1, 1, 1, 1, \
@@ -99,21 +99,13 @@ static const lv_buttonmatrix_ctrl_t attributes_upper_terminal_us[] = { \
 
 static const int num_modifiers_upper_terminal_us = 2;
 
-static const int modifier_idxs_upper_terminal_us[] = { \
-    0, 1 \
-};
-
 static const int num_switchers_upper_terminal_us = 3;
 
-static const int switcher_idxs_upper_terminal_us[] = { \
-    25, 34, 36 \
-};
-
-static const int switcher_dests_upper_terminal_us[] = { \
+static const uint16_t switcher_dests_upper_terminal_us[] = { \
     0, 2, 4 \
 };
 
-static const int num_scancodes_upper_terminal_us = 5;
+static const int num_scancodes_upper_terminal_us = 61;
 
 static const int scancodes_upper_terminal_us[] = { \
     KEY_LEFTCTRL, KEY_LEFTALT, KEY_PAGEUP, KEY_PAGEDOWN, KEY_HOME, KEY_END, \
@@ -123,7 +115,7 @@ static const int scancodes_upper_terminal_us[] = { \
     KEY_SPACE, KEY_ENTER \
 };
 
-static const int scancode_idxs_upper_terminal_us[] = { \
+static const int16_t scancode_idxs_upper_terminal_us[] = { \
     0, 1, 2, 3, 4, 5, \
     6, 8, 10, 12, 14, 16, 18, 20, 22, 24, \
     26, 28, 30, 32, 34, 36, 38, 40, 42, \
@@ -131,7 +123,7 @@ static const int scancode_idxs_upper_terminal_us[] = { \
     -1, 59, -1, 60 \
 };
 
-static const int scancode_nums_upper_terminal_us[] = { \
+static const uint16_t scancode_nums_upper_terminal_us[] = { \
     1, 1, 1, 1, 1, 1, \
     2, 2, 2, 2, 2, 2, 2, 2, 2, 2, \
     2, 2, 2, 2, 2, 2, 2, 2, 2, \
@@ -161,21 +153,17 @@ static const lv_buttonmatrix_ctrl_t attributes_numbers_terminal_us[] = { \
 
 static const int num_modifiers_numbers_terminal_us = 2;
 
-static const int modifier_idxs_numbers_terminal_us[] = { \
-    0, 1 \
-};
-
 static const int num_switchers_numbers_terminal_us = 2;
 
-static const int switcher_idxs_numbers_terminal_us[] = { \
+static const uint16_t switcher_idxs_numbers_terminal_us[] = { \
     26, 35 \
 };
 
-static const int switcher_dests_numbers_terminal_us[] = { \
+static const uint16_t switcher_dests_numbers_terminal_us[] = { \
     3, 0 \
 };
 
-static const int num_scancodes_numbers_terminal_us = 5;
+static const int num_scancodes_numbers_terminal_us = 49;
 
 static const int scancodes_numbers_terminal_us[] = { \
     KEY_LEFTCTRL, KEY_LEFTALT, KEY_UP, KEY_DOWN, KEY_LEFT, KEY_RIGHT, \
@@ -185,7 +173,7 @@ static const int scancodes_numbers_terminal_us[] = { \
     KEY_SPACE, KEY_DOT, KEY_ENTER \
 };
 
-static const int scancode_idxs_numbers_terminal_us[] = { \
+static const int16_t scancode_idxs_numbers_terminal_us[] = { \
     0, 1, 2, 3, 4, 5, \
     6, 7, 8, 9, 10, 11, 12, 13, 14, 15, \
     16, 18, 20, 22, 23, 25, 26, 28, 30, 32, \
@@ -193,7 +181,7 @@ static const int scancode_idxs_numbers_terminal_us[] = { \
     -1, 46, 47, 48 \
 };
 
-static const int scancode_nums_numbers_terminal_us[] = { \
+static const uint16_t scancode_nums_numbers_terminal_us[] = { \
     1, 1, 1, 1, 1, 1, \
     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, \
     2, 2, 2, 1, 2, 1, 2, 2, 2, 2, \
@@ -213,31 +201,15 @@ static const char * const keycaps_symbols_terminal_us[] = { \
     "ABC", " ", ".", LV_SYMBOL_OK, "" \
 };
 
-static const lv_buttonmatrix_ctrl_t attributes_symbols_terminal_us[] = { \
-    SQ2LV_CTRL_MOD_INACTIVE | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, SQ2LV_CTRL_MOD_INACTIVE | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, SQ2LV_CTRL_NON_CHAR | 3, SQ2LV_CTRL_NON_CHAR | 3, SQ2LV_CTRL_NON_CHAR | 3, SQ2LV_CTRL_NON_CHAR | 3, \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, \
-    SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, SQ2LV_CTRL_NON_CHAR | 3, \
-    SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, 7, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, SQ2LV_CTRL_NON_CHAR | 3 \
-};
-
 static const int num_modifiers_symbols_terminal_us = 2;
 
-static const int modifier_idxs_symbols_terminal_us[] = { \
-    0, 1 \
-};
-
 static const int num_switchers_symbols_terminal_us = 2;
 
-static const int switcher_idxs_symbols_terminal_us[] = { \
-    26, 35 \
-};
-
-static const int switcher_dests_symbols_terminal_us[] = { \
+static const uint16_t switcher_dests_symbols_terminal_us[] = { \
     2, 0 \
 };
 
-static const int num_scancodes_symbols_terminal_us = 5;
+static const int num_scancodes_symbols_terminal_us = 33;
 
 static const int scancodes_symbols_terminal_us[] = { \
     KEY_LEFTCTRL, KEY_LEFTALT, KEY_UP, KEY_DOWN, KEY_LEFT, KEY_RIGHT, \
@@ -247,7 +219,7 @@ static const int scancodes_symbols_terminal_us[] = { \
     KEY_SPACE, KEY_DOT, KEY_ENTER \
 };
 
-static const int scancode_idxs_symbols_terminal_us[] = { \
+static const int16_t scancode_idxs_symbols_terminal_us[] = { \
     0, 1, 2, 3, 4, 5, \
     6, 8, 9, -1, -1, -1, -1, -1, -1, -1, \
     -1, -1, -1, -1, -1, 11, -1, 13, 15, 17, \
@@ -255,7 +227,7 @@ static const int scancode_idxs_symbols_terminal_us[] = { \
     -1, 30, 31, 32 \
 };
 
-static const int scancode_nums_symbols_terminal_us[] = { \
+static const uint16_t scancode_nums_symbols_terminal_us[] = { \
     1, 1, 1, 1, 1, 1, \
     2, 1, 2, 0, 0, 0, 0, 0, 0, 0, \
     0, 0, 0, 0, 0, 2, 0, 2, 2, 2, \
@@ -285,21 +257,17 @@ static const lv_buttonmatrix_ctrl_t attributes_actions_terminal_us[] = { \
 
 static const int num_modifiers_actions_terminal_us = 2;
 
-static const int modifier_idxs_actions_terminal_us[] = { \
-    0, 1 \
-};
-
 static const int num_switchers_actions_terminal_us = 1;
 
-static const int switcher_idxs_actions_terminal_us[] = { \
+static const uint16_t switcher_idxs_actions_terminal_us[] = { \
     24 \
 };
 
-static const int switcher_dests_actions_terminal_us[] = { \
+static const uint16_t switcher_dests_actions_terminal_us[] = { \
     0 \
 };
 
-static const int num_scancodes_actions_terminal_us = 5;
+static const int num_scancodes_actions_terminal_us = 29;
 
 static const int scancodes_actions_terminal_us[] = { \
     KEY_LEFTCTRL, KEY_LEFTALT, KEY_PAGEUP, KEY_PAGEDOWN, KEY_HOME, KEY_END, \
@@ -309,7 +277,7 @@ static const int scancodes_actions_terminal_us[] = { \
     KEY_COMPOSE, KEY_BREAK, KEY_LEFT, KEY_DOWN, KEY_RIGHT \
 };
 
-static const int scancode_idxs_actions_terminal_us[] = { \
+static const int16_t scancode_idxs_actions_terminal_us[] = { \
     0, 1, 2, 3, 4, 5, \
     6, 7, 8, 9, 10, 11, \
     12, 13, 14, 15, 16, 17, \
@@ -317,7 +285,7 @@ static const int scancode_idxs_actions_terminal_us[] = { \
     -1, 24, 25, 26, 27, 28 \
 };
 
-static const int scancode_nums_actions_terminal_us[] = { \
+static const uint16_t scancode_nums_actions_terminal_us[] = { \
     1, 1, 1, 1, 1, 1, \
     1, 1, 1, 1, 1, 1, \
     1, 1, 1, 1, 1, 1, \
@@ -349,9 +317,9 @@ static const sq2lv_layer_t layers_terminal_us[] = {
         .keycaps = keycaps_upper_terminal_us,
         .attributes = attributes_upper_terminal_us,
         .num_modifiers = num_modifiers_upper_terminal_us,
-        .modifier_idxs = modifier_idxs_upper_terminal_us,
+        .modifier_idxs = modifier_idxs_lower_terminal_us,
         .num_switchers = num_switchers_upper_terminal_us,
-        .switcher_idxs = switcher_idxs_upper_terminal_us,
+        .switcher_idxs = switcher_idxs_lower_terminal_us,
         .switcher_dests = switcher_dests_upper_terminal_us,
         .num_scancodes = num_scancodes_upper_terminal_us,
         .scancodes = scancodes_upper_terminal_us,
@@ -363,7 +331,7 @@ static const sq2lv_layer_t layers_terminal_us[] = {
         .keycaps = keycaps_numbers_terminal_us,
         .attributes = attributes_numbers_terminal_us,
         .num_modifiers = num_modifiers_numbers_terminal_us,
-        .modifier_idxs = modifier_idxs_numbers_terminal_us,
+        .modifier_idxs = modifier_idxs_lower_terminal_us,
         .num_switchers = num_switchers_numbers_terminal_us,
         .switcher_idxs = switcher_idxs_numbers_terminal_us,
         .switcher_dests = switcher_dests_numbers_terminal_us,
@@ -375,11 +343,11 @@ static const sq2lv_layer_t layers_terminal_us[] = {
     {
         .num_keys = num_keys_symbols_terminal_us,
         .keycaps = keycaps_symbols_terminal_us,
-        .attributes = attributes_symbols_terminal_us,
+        .attributes = attributes_numbers_terminal_us,
         .num_modifiers = num_modifiers_symbols_terminal_us,
-        .modifier_idxs = modifier_idxs_symbols_terminal_us,
+        .modifier_idxs = modifier_idxs_lower_terminal_us,
         .num_switchers = num_switchers_symbols_terminal_us,
-        .switcher_idxs = switcher_idxs_symbols_terminal_us,
+        .switcher_idxs = switcher_idxs_numbers_terminal_us,
         .switcher_dests = switcher_dests_symbols_terminal_us,
         .num_scancodes = num_scancodes_symbols_terminal_us,
         .scancodes = scancodes_symbols_terminal_us,
@@ -391,7 +359,7 @@ static const sq2lv_layer_t layers_terminal_us[] = {
         .keycaps = keycaps_actions_terminal_us,
         .attributes = attributes_actions_terminal_us,
         .num_modifiers = num_modifiers_actions_terminal_us,
-        .modifier_idxs = modifier_idxs_actions_terminal_us,
+        .modifier_idxs = modifier_idxs_lower_terminal_us,
         .num_switchers = num_switchers_actions_terminal_us,
         .switcher_idxs = switcher_idxs_actions_terminal_us,
         .switcher_dests = switcher_dests_actions_terminal_us,
@@ -30,17 +30,17 @@ typedef struct {
     /* Number of buttons that trigger a layer switch */
     const int num_switchers;
     /* Button indexes that trigger a layer switch */
-    const int * const switcher_idxs;
+    const uint16_t * const switcher_idxs;
     /* Indexes of layers to jump to when triggering layer switch buttons */
-    const int * const switcher_dests;
+    const uint16_t * const switcher_dests;
     /* Total number of scancodes */
     const int num_scancodes;
     /* Flat array of scancodes */
     const int * const scancodes;
     /* Start index in scancodes array for key cap */
-    const int * const scancode_idxs;
+    const int16_t * const scancode_idxs;
     /* Number of scancodes for key cap */
-    const int * const scancode_nums;
+    const uint16_t * const scancode_nums;
 } sq2lv_layer_t;
 
 /* Layout type */
@@ -18,6 +18,18 @@
 #include <sys/ioctl.h>
 
 
+/**
+ * Cached state of a virtual terminal
+ */
+typedef struct {
+    /* Size of a font cell in pixels, 0 if unknown */
+    unsigned int font_width;
+    unsigned int font_height;
+    /* Size that was last applied by us */
+    struct winsize size;
+} bb_terminal_vt_state;
+
+
 /**
  * Static variables
  */
@@ -26,6 +38,82 @@ static int32_t _tty_size;
 static int32_t _h_display_size;
 static int32_t _v_display_size;
 
+static bb_terminal_vt_state vt_states[MAX_NR_CONSOLES + 1];
+
+
+/**
+ * Static prototypes
+ */
+
+/**
+ * Query the font cell size of a terminal.
+ *
+ * @param fd terminal file descriptor
+ * @param state cached state to write the font cell size into
+ * @return true on success, false otherwise
+ */
+static bool query_font(int fd, bb_terminal_vt_state *state);
+
+/**
+ * Resize a terminal to fill a given height unless it already has the right size.
+ *
+ * @param fd terminal file descriptor
+ * @param state cached state of the terminal
+ * @param height height in pixels
+ * @return true if the terminal has the requested size, false otherwise
+ */
+static bool resize(int fd, bb_terminal_vt_state *state, int32_t height);
+
+
+/**
+ * Static functions
+ */
+
+static bool query_font(int fd, bb_terminal_vt_state *state) {
+    struct console_font_op cfo = {
+        .op = KD_FONT_OP_GET,
+        .width = UINT_MAX,
+        .height = UINT_MAX,
+        .charcount = UINT_MAX,
+        .data = NULL
+    };
+    /* KDFONTOP returns EINVAL if we are not in the text mode */
+    if (ioctl(fd, KDFONTOP, &cfo) != 0 || cfo.width == 0 || cfo.height == 0) {
+        state->font_width = 0;
+        state->font_height = 0;
+        return false;
+    }
+
+    state->font_width = cfo.width;
+    state->font_height = cfo.height;
+    return true;
+}
+
+static bool resize(int fd, bb_terminal_vt_state *state, int32_t height) {
+    struct winsize current;
+    if (ioctl(fd, TIOCGWINSZ, &current) != 0)
+        return false;
+
+    /* The kernel resizes a terminal when its font changes. As long as the terminal still has the size we
+       applied last, the cached font is therefore up to date. */
+    bool is_untouched = state->font_height != 0
+        && current.ws_row == state->size.ws_row
+        && current.ws_col == state->size.ws_col;
+    if (!is_untouched && !query_font(fd, state))
+        return false;
+
+    struct winsize size = current;
+    size.ws_row = height / state->font_height;
+    size.ws_col = _h_display_size / state->font_width;
+    state->size = size;
+
+    /* Every resize sends SIGWINCH to the processes on the terminal, so skip redundant ones */
+    if (size.ws_row == current.ws_row && size.ws_col == current.ws_col)
+        return true;
+
+    return ioctl(fd, TIOCSWINSZ, &size) == 0;
+}
+
 
 /**
  * Public functions
@@ -53,20 +141,11 @@ void bb_terminal_shrink_current() {
         goto end;
     }
 
-    struct console_font_op cfo = {
-        .op = KD_FONT_OP_GET,
-        .width = UINT_MAX,
-        .height = UINT_MAX,
-        .charcount = UINT_MAX,
-        .data = NULL
-    };
-    if (ioctl(fd, KDFONTOP, &cfo) != 0)
+    struct vt_stat state;
+    if (ioctl(fd, VT_GETSTATE, &state) != 0 || state.v_active > MAX_NR_CONSOLES)
         goto end;
 
-    struct winsize size;
-    size.ws_row = _tty_size / cfo.height;
-    size.ws_col = _h_display_size / cfo.width;
-    ioctl(fd, TIOCSWINSZ, &size);
+    resize(fd, &vt_states[state.v_active], _tty_size);
 end:
     close(fd);
 }
@@ -88,38 +167,17 @@ void bb_terminal_reset_all() {
     unsigned short mask = state.v_state >> 1;
     unsigned int tty = 1;
 
-    for (; mask; mask >>= 1, tty++) {
+    for (; mask && tty <= MAX_NR_CONSOLES; mask >>= 1, tty++) {
+        /* Terminals may have been shrunk by an earlier instance, so reset all of them. Those that
+           already have the full size are skipped by resize(). */
         if (mask & 0x01) {
             sprintf(buffer, "/dev/tty%u", tty);
             int tty_fd = open(buffer, O_RDONLY|O_NOCTTY);
             if (tty_fd < 0)
                 continue;
 
-            /* KDFONTOP returns EINVAL if we are not in the text mode,
-               so we can skip this check */
-/*
-            int mode;
-            if (ioctl(tty_fd, KDGETMODE, &mode) != 0)
-                goto end;
-
-            if (mode != KD_TEXT)
-                goto end;
-*/
-            struct console_font_op cfo = {
-                .op = KD_FONT_OP_GET,
-                .width = UINT_MAX,
-                .height = UINT_MAX,
-                .charcount = UINT_MAX,
-                .data = NULL
-            };
-            if (ioctl(tty_fd, KDFONTOP, &cfo) != 0)
-                goto end;
-
-            struct winsize size;
-            size.ws_row = _v_display_size / cfo.height;
-            size.ws_col = _h_display_size / cfo.width;
-            ioctl(tty_fd, TIOCSWINSZ, &size);
-end:
+            resize(tty_fd, &vt_states[tty], _v_display_size);
+
             close(tty_fd);
         }
     }
@@ -87,6 +87,12 @@ bool bb_uinput_device_init(const int * const scancodes, int num_scancodes) {
 		return false;
 	}
 
+	/* Let the kernel generate repeats for held keys */
+	if (ioctl(fd, UI_SET_EVBIT, EV_REP) < 0) {
+		perror("Could not set EVBIT for EV_REP");
+		return false;
+	}
+
 	for (int i = 0; i < num_scancodes; ++i) {
         if (ioctl(fd, UI_SET_KEYBIT, scancodes[i]) < 0) {
             perror("Could not set KEYBIT");
@@ -117,6 +123,11 @@ bool bb_uinput_device_init(const int * const scancodes, int num_scancodes) {
     return true;
 }
 
+bool bb_uinput_device_set_repeat(int delay, int period) {
+    /* A delay or period of 0 disables autorepeat in the kernel */
+    return uinput_device_emit(EV_REP, REP_DELAY, delay) && uinput_device_emit(EV_REP, REP_PERIOD, period);
+}
+
 bool bb_uinput_device_emit_key_down(int scancode) {
     return uinput_device_emit(EV_KEY, scancode, 1) && uinput_device_synchronise();
 }
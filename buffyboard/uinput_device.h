@@ -18,6 +18,15 @@
  */
 bool bb_uinput_device_init(const int * const scancodes, int num_scancodes);
 
+/**
+ * Configure the autorepeat of held keys
+ *
+ * @param delay delay in milliseconds before a held key starts repeating, 0 to disable autorepeat
+ * @param period interval between repeats in milliseconds, 0 to disable autorepeat
+ * @return true if configuring autorepeat was successful, false otherwise
+ */
+bool bb_uinput_device_set_repeat(int delay, int period);
+
 /**
  * Emit a key down event
  * 
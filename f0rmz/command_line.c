@@ -13,6 +13,8 @@
 static void init_opts(f0_cli_opts *opts) {
     bbx_cli_init_common_opts(&opts->common);
     opts->config_file = NULL;
+    opts->output_fd = -1;
+    opts->output_format = F0_STREAM_FORMAT_JSONL;
 }
 
 static void print_usage() {
@@ -22,6 +24,11 @@ static void print_usage() {
         "  -C, --config              Path to form configuration file\n"
         "  -g, --geometry=NxM[@X,Y]  Force display size and offset\n"
         "  -d, --dpi=N               Override display DPI\n"
+        "  -o, --output-fd=FD        Stream each field to FD as soon as it is saved\n"
+        "  -f, --output-format=FMT   Record format for --output-fd: jsonl or nul\n"
+        "      --record-input=PATH   Record all input events to PATH\n"
+        "      --replay-input=PATH   Replay input events from PATH and exit afterwards\n"
+        "      --replay-fast         Replay input events as fast as possible\n"
         "  -h, --help                Show this help\n"
         "  -v, --verbose             Enable verbose logging\n"
         "  -V, --version             Show version\n");
@@ -31,17 +38,22 @@ void f0_cli_parse_opts(int argc, char *argv[], f0_cli_opts *opts) {
     init_opts(opts);
 
     struct option long_opts[] = {
-        { "config",   required_argument, NULL, 'C' },
-        { "geometry", required_argument, NULL, 'g' },
-        { "dpi",      required_argument, NULL, 'd' },
-        { "help",     no_argument,       NULL, 'h' },
-        { "verbose",  no_argument,       NULL, 'v' },
-        { "version",  no_argument,       NULL, 'V' },
+        { "config",        required_argument, NULL, 'C' },
+        { "geometry",      required_argument, NULL, 'g' },
+        { "dpi",           required_argument, NULL, 'd' },
+        { "output-fd",     required_argument, NULL, 'o' },
+        { "output-format", required_argument, NULL, 'f' },
+        { "help",          no_argument,       NULL, 'h' },
+        { "verbose",       no_argument,       NULL, 'v' },
+        { "version",       no_argument,       NULL, 'V' },
+        { "record-input",  required_argument, NULL, BBX_CLI_OPT_RECORD_INPUT },
+        { "replay-input",  required_argument, NULL, BBX_CLI_OPT_REPLAY_INPUT },
+        { "replay-fast",   no_argument,       NULL, BBX_CLI_OPT_REPLAY_FAST },
         { NULL, 0, NULL, 0 }
     };
 
     int opt;
-    while ((opt = getopt_long(argc, argv, "C:g:d:hvV", long_opts, NULL)) != -1) {
+    while ((opt = getopt_long(argc, argv, "C:g:d:o:f:hvV", long_opts, NULL)) != -1) {
         switch (opt) {
         case 'C':
             opts->config_file = optarg;
@@ -56,6 +68,18 @@ void f0_cli_parse_opts(int argc, char *argv[], f0_cli_opts *opts) {
                 exit(EXIT_FAILURE);
             }
             break;
+        case 'o':
+            if (sscanf(optarg, "%i", &opts->output_fd) != 1 || opts->output_fd < 0) {
+                bbx_log(BBX_LOG_LEVEL_ERROR, "Invalid output fd argument \"%s\"", optarg);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case 'f':
+            if (!f0_stream_find_format_with_name(optarg, &opts->output_format)) {
+                bbx_log(BBX_LOG_LEVEL_ERROR, "Invalid output format argument \"%s\"", optarg);
+                exit(EXIT_FAILURE);
+            }
+            break;
         case 'h':
             print_usage();
             exit(EXIT_SUCCESS);
@@ -65,6 +89,15 @@ void f0_cli_parse_opts(int argc, char *argv[], f0_cli_opts *opts) {
         case 'V':
             bbx_cli_print_version_and_exit("f0rmz");
             break;
+        case BBX_CLI_OPT_RECORD_INPUT:
+            opts->common.record_input = optarg;
+            break;
+        case BBX_CLI_OPT_REPLAY_INPUT:
+            opts->common.replay_input = optarg;
+            break;
+        case BBX_CLI_OPT_REPLAY_FAST:
+            opts->common.replay_fast = true;
+            break;
         default:
             print_usage();
             exit(EXIT_FAILURE);
@@ -6,11 +6,17 @@
 #ifndef F0_COMMAND_LINE_H
 #define F0_COMMAND_LINE_H
 
+#include "stream.h"
+
 #include "../shared/cli_common.h"
 
 typedef struct {
     bbx_cli_common_opts common;
     const char *config_file;
+    /* File descriptor to stream field values to, or -1 */
+    int output_fd;
+    /* Record format for the output stream */
+    f0_stream_format_t output_format;
 } f0_cli_opts;
 
 void f0_cli_parse_opts(int argc, char *argv[], f0_cli_opts *opts);
@@ -29,150 +29,338 @@
  */
 static int parsing_handler(void* user_data, const char* section, const char* key, const char* value);
 
+/**
+ * Parse a string option value by copying it into the string arena of the options being parsed.
+ *
+ * @param value string to parse
+ * @param result pointer to a const char * to write the copied string into if parsing is successful
+ * @return true on success, false otherwise
+ */
+static bool parse_string(const char *value, void *result);
+
+/**
+ * Parse a form field condition in the format "field=value" or "field!=value".
+ *
+ * @param value string to parse
+ * @param result pointer to a f0_field_condition_t to write the condition into if parsing is successful
+ * @return true on success, false otherwise
+ */
+static bool parse_condition(const char *value, void *result);
+
+/**
+ * Resolve a form field condition to the index of the field it refers to.
+ *
+ * @param opts pointer to the options struct
+ * @param field_index index of the field the condition belongs to
+ * @param condition condition to resolve
+ * @param key option key of the condition (for logging)
+ */
+static void resolve_condition(f0_config_opts *opts, int field_index, f0_field_condition_t *condition, const char *key);
+
+/**
+ * Hash a form field name.
+ *
+ * @param name field name
+ * @return hash of the name
+ */
+static uint32_t hash_field_name(const char *name);
+
+/**
+ * Look up the index of a form field by name.
+ *
+ * @param opts pointer to the options struct
+ * @param name field name
+ * @return index of the field or -1 if there is no such field
+ */
+static int find_field_index(const f0_config_opts *opts, const char *name);
+
+/**
+ * Add the last form field to the name index, growing the index if needed.
+ *
+ * @param opts pointer to the options struct
+ * @return true on success, false if memory could not be allocated
+ */
+static bool index_last_field(f0_config_opts *opts);
+
+/**
+ * Find a form field by name or append a new one.
+ *
+ * @param opts pointer to the options struct
+ * @param name field name
+ * @return pointer to the field or NULL if memory could not be allocated
+ */
+static f0_form_field_t *find_or_add_field(f0_config_opts *opts, const char *name);
+
+/**
+ * Parse a form field type option value.
+ *
+ * @param value type name
+ * @param result pointer to a f0_field_type_t to write the type into if parsing is successful
+ * @return true on success, false otherwise
+ */
+static bool parse_field_type(const char *value, void *result);
+
+/**
+ * Static variables
+ */
+
+#define OPTION(section, key, parse, member) BBX_CONFIG_OPTION(section, key, parse, f0_config_opts, member)
+#define FIELD_OPTION(key, parse, member) BBX_CONFIG_OPTION("form", key, parse, f0_form_field_t, member)
+
+/* Keep sorted by section and then by key */
+static const bbx_config_option options[] = {
+    OPTION("general", "backend", bbx_backends_parse_backend_option, general.backend),
+    OPTION("general", "memory_bpp", bbx_backends_parse_memory_bpp_option, general.memory_bpp),
+    OPTION("general", "memory_file", parse_string, general.memory_file),
+    OPTION("hardware keyboard", "layout", parse_string, hw_keyboard.layout),
+    OPTION("hardware keyboard", "model", parse_string, hw_keyboard.model),
+    OPTION("hardware keyboard", "options", parse_string, hw_keyboard.options),
+    OPTION("hardware keyboard", "rules", parse_string, hw_keyboard.rules),
+    OPTION("hardware keyboard", "variant", parse_string, hw_keyboard.variant),
+    OPTION("input", "keyboard", bbx_config_parse_bool_option, input.keyboard),
+    OPTION("input", "pointer", bbx_config_parse_bool_option, input.pointer),
+    OPTION("input", "touchscreen", bbx_config_parse_bool_option, input.touchscreen),
+    OPTION("intro", "body", parse_string, intro.body),
+    OPTION("intro", "title", parse_string, intro.title),
+    OPTION("keyboard", "autohide", bbx_config_parse_bool_option, keyboard.autohide),
+    OPTION("keyboard", "layout", sq2lv_parse_layout_option, keyboard.layout_id),
+    OPTION("keyboard", "popovers", bbx_config_parse_bool_option, keyboard.popovers),
+    OPTION("quirks", "fbdev_force_refresh", bbx_config_parse_bool_option, quirks.fbdev_force_refresh),
+    OPTION("quirks", "terminal_allow_keyboard_input", bbx_config_parse_bool_option, quirks.terminal_allow_keyboard_input),
+    OPTION("quirks", "terminal_prevent_graphics_mode", bbx_config_parse_bool_option, quirks.terminal_prevent_graphics_mode),
+    OPTION("theme", "alternate", bbx_config_parse_theme_option, theme.alternate_id),
+    OPTION("theme", "default", bbx_config_parse_theme_option, theme.default_id),
+};
+
+static const bbx_config_schema schema = { options, sizeof(options) / sizeof(options[0]) };
+
+/* Properties of the fields declared in form.<name> sections, keep sorted by key */
+static const bbx_config_option field_options[] = {
+    FIELD_OPTION("label", parse_string, label),
+    FIELD_OPTION("required", bbx_config_parse_bool_option, required),
+    FIELD_OPTION("show_if", parse_condition, show_if),
+    FIELD_OPTION("skip_if", parse_condition, skip_if),
+    FIELD_OPTION("type", parse_field_type, type),
+};
+
+static const bbx_config_schema field_schema = { field_options, sizeof(field_options) / sizeof(field_options[0]) };
+
+/* String arena of the options that are currently being parsed */
+static f0_store_arena_t *parsing_arena = NULL;
+
 /**
  * Static functions
  */
 
-static int parsing_handler(void* user_data, const char* section, const char* key, const char* value) {
-    f0_config_opts *opts = (f0_config_opts *)user_data;
+static bool parse_string(const char *value, void *result) {
+    char *string = f0_store_arena_strdup(parsing_arena, value);
+    if (!string) {
+        return false;
+    }
+    *(const char **)result = string;
+    return true;
+}
 
-    if (strcmp(section, "general") == 0) {
-        if (strcmp(key, "backend") == 0) {
-            bbx_backends_backend_id_t id = bbx_backends_find_backend_with_name(value);
-            if (id != BBX_BACKENDS_BACKEND_NONE) {
-                opts->general.backend = id;
-                return 1;
-            }
-        }
-    } else if (strcmp(section, "keyboard") == 0) {
-        if (strcmp(key, "autohide") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->keyboard.autohide))) {
-                return 1;
-            }
-        } else if (strcmp(key, "layout") == 0) {
-            sq2lv_layout_id_t id = sq2lv_find_layout_with_short_name(value);
-            if (id != SQ2LV_LAYOUT_NONE) {
-                opts->keyboard.layout_id = id;
-                return 1;
-            }
-        } else if (strcmp(key, "popovers") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->keyboard.popovers))) {
-                return 1;
-            }
-        }
-    } else if (strcmp(section, "theme") == 0) {
-        if (strcmp(key, "default") == 0) {
-            bbx_themes_theme_id_t id = bbx_themes_find_theme_with_name(value);
-            if (id != BBX_THEMES_THEME_NONE) {
-                opts->theme.default_id = id;
-                return 1;
-            }
-        } else if (strcmp(key, "alternate") == 0) {
-            bbx_themes_theme_id_t id = bbx_themes_find_theme_with_name(value);
-            if (id != BBX_THEMES_THEME_NONE) {
-                opts->theme.alternate_id = id;
-                return 1;
-            }
-        }
-    } else if (strcmp(section, "input") == 0) {
-        if (strcmp(key, "keyboard") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->input.keyboard))) {
-                return 1;
-            }
-        } else if (strcmp(key, "pointer") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->input.pointer))) {
-                return 1;
-            }
-        } else if (strcmp(key, "touchscreen") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->input.touchscreen))) {
-                return 1;
-            }
-        }
-    } else if (strcmp(section, "hardware keyboard") == 0) {
-        if (strcmp(key, "rules") == 0) {
-            opts->hw_keyboard.rules = strdup(value);
-            return 1;
-        } else if (strcmp(key, "model") == 0) {
-            opts->hw_keyboard.model = strdup(value);
-            return 1;
-        } else if (strcmp(key, "layout") == 0) {
-            opts->hw_keyboard.layout = strdup(value);
-            return 1;
-        } else if (strcmp(key, "variant") == 0) {
-            opts->hw_keyboard.variant = strdup(value);
-            return 1;
-        } else if (strcmp(key, "options") == 0) {
-            opts->hw_keyboard.options = strdup(value);
-            return 1;
-        }
-    } else if (strcmp(section, "quirks") == 0) {
-        if (strcmp(key, "fbdev_force_refresh") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->quirks.fbdev_force_refresh))) {
-                return 1;
-            }
-        } else if (strcmp(key, "terminal_prevent_graphics_mode") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->quirks.terminal_prevent_graphics_mode))) {
-                return 1;
-            }
-        } else if (strcmp(key, "terminal_allow_keyboard_input") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->quirks.terminal_allow_keyboard_input))) {
-                return 1;
-            }
+static bool parse_condition(const char *value, void *result) {
+    const char *separator = strchr(value, '=');
+    if (!separator) {
+        return false;
+    }
+
+    bool negate = separator > value && separator[-1] == '!';
+    const char *field_end = negate ? separator - 1 : separator;
+    const char *value_start = separator + 1;
+
+    /* Allow spaces around the operator */
+    while (field_end > value && (field_end[-1] == ' ' || field_end[-1] == '\t')) {
+        --field_end;
+    }
+    while (*value_start == ' ' || *value_start == '\t') {
+        ++value_start;
+    }
+    if (field_end == value) {
+        return false;
+    }
+
+    size_t field_length = field_end - value;
+    char field_name[field_length + 1];
+    memcpy(field_name, value, field_length);
+    field_name[field_length] = '\0';
+
+    const char *field = f0_store_arena_strdup(parsing_arena, field_name);
+    const char *field_value = f0_store_arena_strdup(parsing_arena, value_start);
+    if (!field || !field_value) {
+        return false;
+    }
+
+    f0_field_condition_t *condition = (f0_field_condition_t *)result;
+    condition->field = field;
+    condition->field_index = -1;
+    condition->value = field_value;
+    condition->negate = negate;
+    return true;
+}
+
+static void resolve_condition(f0_config_opts *opts, int field_index, f0_field_condition_t *condition, const char *key) {
+    if (!condition->field) {
+        return;
+    }
+
+    f0_form_field_t *field = &opts->fields[field_index];
+
+    /* Conditions may only refer to earlier fields so that the form can be evaluated front to back */
+    condition->field_index = find_field_index(opts, condition->field);
+    if (condition->field_index >= field_index) {
+        condition->field_index = -1;
+    }
+
+    if (condition->field_index == -1) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Ignoring %s of field \"%s\" because \"%s\" is not an earlier field", key, field->name, condition->field);
+        condition->field = NULL;
+        return;
+    }
+
+    f0_form_field_t *target = &opts->fields[condition->field_index];
+    int *dependents = realloc(target->dependents, (target->num_dependents + 1) * sizeof(int));
+    if (!dependents) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for field dependencies");
+        condition->field = NULL;
+        return;
+    }
+
+    /* Both conditions of a field may refer to the same field, but it only needs to be re-evaluated once */
+    target->dependents = dependents;
+    if (target->num_dependents == 0 || dependents[target->num_dependents - 1] != field_index) {
+        dependents[target->num_dependents++] = field_index;
+    }
+}
+
+static uint32_t hash_field_name(const char *name) {
+    /* 32-bit FNV-1a */
+    uint32_t hash = 2166136261u;
+    for (const unsigned char *p = (const unsigned char *)name; *p; ++p) {
+        hash ^= *p;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static int find_field_index(const f0_config_opts *opts, const char *name) {
+    if (opts->num_field_slots == 0) {
+        return -1;
+    }
+
+    const uint32_t mask = opts->num_field_slots - 1;
+    for (uint32_t slot = hash_field_name(name) & mask; opts->field_slots[slot] != -1; slot = (slot + 1) & mask) {
+        if (strcmp(opts->fields[opts->field_slots[slot]].name, name) == 0) {
+            return opts->field_slots[slot];
         }
-    } else if (strcmp(section, "intro") == 0) {
-        if (strcmp(key, "title") == 0) {
-            char *title = strdup(value);
-            if (title) {
-                opts->intro.title = title;
-                return 1;
-            }
-        } else if (strcmp(key, "body") == 0) {
-            char *body = strdup(value);
-            if (body) {
-                opts->intro.body = body;
-                return 1;
-            }
+    }
+    return -1;
+}
+
+static bool index_last_field(f0_config_opts *opts) {
+    /* Keep the table at most half full so that probe sequences stay short */
+    if (opts->num_fields * 2 > opts->num_field_slots) {
+        int num_slots = opts->num_field_slots ? opts->num_field_slots * 2 : 16;
+        int *slots = malloc(num_slots * sizeof(int));
+        if (!slots) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for form field index");
+            return false;
         }
-    } else if (strncmp(section, "form.", 5) == 0) {
-        /* Extract field name */
-        const char *field_name = section + 5;
+        free(opts->field_slots);
+        opts->field_slots = slots;
+        opts->num_field_slots = num_slots;
 
-        /* Find or create field */
-        f0_form_field_t *field = NULL;
-        for (int i = 0; i < opts->num_fields; i++) {
-            if (strcmp(opts->fields[i].name, field_name) == 0) {
-                field = &opts->fields[i];
-                break;
+        /* Rebuild the index, including the new field */
+        memset(slots, 0xff, num_slots * sizeof(int));
+        for (int i = 0; i < opts->num_fields; ++i) {
+            uint32_t slot = hash_field_name(opts->fields[i].name) & (num_slots - 1);
+            while (slots[slot] != -1) {
+                slot = (slot + 1) & (num_slots - 1);
             }
+            slots[slot] = i;
         }
+        return true;
+    }
+
+    const uint32_t mask = opts->num_field_slots - 1;
+    uint32_t slot = hash_field_name(opts->fields[opts->num_fields - 1].name) & mask;
+    while (opts->field_slots[slot] != -1) {
+        slot = (slot + 1) & mask;
+    }
+    opts->field_slots[slot] = opts->num_fields - 1;
+    return true;
+}
+
+static f0_form_field_t *find_or_add_field(f0_config_opts *opts, const char *name) {
+    /* Keys of a section arrive consecutively, so the last field is almost always the one we're looking for */
+    if (opts->num_fields > 0 && strcmp(opts->fields[opts->num_fields - 1].name, name) == 0) {
+        return &opts->fields[opts->num_fields - 1];
+    }
+
+    int index = find_field_index(opts, name);
+    if (index != -1) {
+        return &opts->fields[index];
+    }
 
-        if (!field) {
-            /* Create new field */
-            opts->fields = realloc(opts->fields, (opts->num_fields + 1) * sizeof(f0_form_field_t));
-            field = &opts->fields[opts->num_fields];
-            lv_memzero(field, sizeof(f0_form_field_t));
-            field->name = strdup(field_name);
-            opts->num_fields++;
+    if (opts->num_fields == opts->fields_capacity) {
+        int capacity = opts->fields_capacity ? opts->fields_capacity * 2 : 8;
+        f0_form_field_t *fields = realloc(opts->fields, capacity * sizeof(f0_form_field_t));
+        if (!fields) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for form field");
+            return NULL;
         }
+        opts->fields = fields;
+        opts->fields_capacity = capacity;
+    }
+
+    char *field_name = f0_store_arena_strdup(&opts->strings, name);
+    if (!field_name) {
+        return NULL;
+    }
+
+    f0_form_field_t *field = &opts->fields[opts->num_fields];
+    lv_memzero(field, sizeof(f0_form_field_t));
+    field->name = field_name;
+    opts->num_fields++;
+
+    if (!index_last_field(opts)) {
+        opts->num_fields--;
+        return NULL;
+    }
+    return field;
+}
+
+static bool parse_field_type(const char *value, void *result) {
+    if (strcmp(value, "text") == 0) {
+        *(f0_field_type_t *)result = F0_FIELD_TYPE_TEXT;
+        return true;
+    } else if (strcmp(value, "password") == 0) {
+        *(f0_field_type_t *)result = F0_FIELD_TYPE_PASSWORD;
+        return true;
+    }
+    return false;
+}
+
+static int parsing_handler(void* user_data, const char* section, const char* key, const char* value) {
+    f0_config_opts *opts = (f0_config_opts *)user_data;
+    parsing_arena = &opts->strings;
+
+    if (bbx_config_apply_option(&schema, opts, section, key, value)) {
+        return 1;
+    }
+
+    if (strncmp(section, "form.", 5) == 0) {
+        /* Find or create field */
+        f0_form_field_t *field = find_or_add_field(opts, section + 5);
 
         /* Parse field properties */
-        if (strcmp(key, "type") == 0) {
-            if (strcmp(value, "text") == 0) {
-                field->type = F0_FIELD_TYPE_TEXT;
-                return 1;
-            } else if (strcmp(value, "password") == 0) {
-                field->type = F0_FIELD_TYPE_PASSWORD;
-                return 1;
-            }
-        } else if (strcmp(key, "label") == 0) {
-            field->label = strdup(value);
+        if (field && bbx_config_apply_option(&field_schema, field, "form", key, value)) {
             return 1;
-        } else if (strcmp(key, "required") == 0) {
-            if (bbx_config_parse_bool(value, &field->required)) {
-                return 1;
-            }
         }
     }
+
     bbx_log(BBX_LOG_LEVEL_ERROR, "Ignoring invalid config value \"%s\" for key \"%s\" in section \"%s\"", value, key, section);
     return 1; /* Return 1 (true) so that we can use the return value of ini_parse exclusively for file-level errors */
 }
@@ -182,7 +370,11 @@ static int parsing_handler(void* user_data, const char* section, const char* key
  */
 
 void f0_config_init_opts(f0_config_opts *opts) {
+    bbx_config_check_schemas(&schema, &field_schema, NULL);
+
     opts->general.backend = 0;
+    opts->general.memory_bpp = 32;
+    opts->general.memory_file = NULL;
     opts->intro.title = "A Form!";
     opts->intro.body = "Please complete the following form.";
     opts->theme.default_id = BBX_THEMES_THEME_BREEZY_DARK;
@@ -205,6 +397,17 @@ void f0_config_init_opts(f0_config_opts *opts) {
     opts->quirks.terminal_allow_keyboard_input = false;
     opts->fields = NULL;
     opts->num_fields = 0;
+    opts->fields_capacity = 0;
+    opts->field_slots = NULL;
+    opts->num_field_slots = 0;
+    f0_store_arena_init(&opts->strings);
+}
+
+void f0_config_resolve_fields(f0_config_opts *opts) {
+    for (int i = 0; i < opts->num_fields; ++i) {
+        resolve_condition(opts, i, &opts->fields[i].show_if, "show_if");
+        resolve_condition(opts, i, &opts->fields[i].skip_if, "skip_if");
+    }
 }
 
 void f0_config_parse_directory(const char *path, f0_config_opts *opts) {
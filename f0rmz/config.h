@@ -10,6 +10,7 @@
 #include "../shared/themes.h"
 
 #include "sq2lv_layouts.h"
+#include "store.h"
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -21,6 +22,10 @@
 typedef struct {
     /* Backend to use */
     bbx_backends_backend_id_t backend;
+    /* Bits per pixel to render with when using the memory backend, 16 or 32 */
+    int memory_bpp;
+    /* File to mirror the screen into when using the memory backend, NULL to only render into memory */
+    const char *memory_file;
 } f0_config_opts_general;
 
 /**
@@ -101,6 +106,20 @@ typedef enum {
     F0_FIELD_TYPE_PASSWORD
 } f0_field_type_t;
 
+/**
+ * Condition on the value of an earlier form field
+ */
+typedef struct {
+    /* Name of the field the condition refers to or NULL if the condition is unset */
+    const char *field;
+    /* Index of the field the condition refers to (set by f0_config_resolve_fields) */
+    int field_index;
+    /* Value to compare with */
+    const char *value;
+    /* If true, the condition is met when the value differs */
+    bool negate;
+} f0_field_condition_t;
+
 /**
  * Form field definition
  */
@@ -109,6 +128,13 @@ typedef struct {
     f0_field_type_t type;
     char *label;
     bool required;
+    /* Only show the field if this condition is met */
+    f0_field_condition_t show_if;
+    /* Skip the field if this condition is met */
+    f0_field_condition_t skip_if;
+    /* Indexes of later fields whose conditions refer to this field */
+    int *dependents;
+    int num_dependents;
 } f0_form_field_t;
 
 typedef struct {
@@ -132,6 +158,14 @@ typedef struct {
     f0_form_field_t *fields;
     /* Number of form fields/pages */
     int num_fields;
+    /* Number of fields that fit into the allocated array */
+    int fields_capacity;
+    /* Open-addressing hash table of indexes into fields by name (-1 marks empty slots) */
+    int *field_slots;
+    /* Number of slots in the hash table (a power of two) */
+    int num_field_slots;
+    /* Storage for strings parsed from config files */
+    f0_store_arena_t strings;
 } f0_config_opts;
 
 /**
@@ -141,6 +175,14 @@ typedef struct {
  */
 void f0_config_init_opts(f0_config_opts *opts);
 
+/**
+ * Resolve the conditions of form fields after all configuration files have been parsed. Conditions that
+ * don't refer to an earlier field are ignored.
+ *
+ * @param opts pointer to the options struct
+ */
+void f0_config_resolve_fields(f0_config_opts *opts);
+
 /**
  * Find configuration files in a directory and parse them in alphabetic order.
  *
@@ -0,0 +1,143 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "flow.h"
+
+#include "../shared/log.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Static variables
+ */
+
+static const f0_config_opts *flow_opts = NULL;
+static const f0_store_value_t *flow_values = NULL;
+static bool *visible = NULL;
+static bool *dirty = NULL;
+
+/**
+ * Static prototypes
+ */
+
+/**
+ * Check whether a field condition is met by the current values.
+ *
+ * @param condition resolved condition
+ * @return true if the condition is met, false otherwise
+ */
+static bool is_condition_met(const f0_field_condition_t *condition);
+
+/**
+ * Evaluate the visibility of a field from the current values and the visibility of earlier fields.
+ *
+ * @param field_index index of the field
+ * @return true if the field should be visible, false otherwise
+ */
+static bool evaluate(int field_index);
+
+/**
+ * Mark the dependents of a field for re-evaluation.
+ *
+ * @param field_index index of the field
+ * @return number of fields that were newly marked
+ */
+static int mark_dependents(int field_index);
+
+/**
+ * Static functions
+ */
+
+static bool is_condition_met(const f0_field_condition_t *condition) {
+    int index = condition->field_index;
+    const char *value = visible[index] ? f0_store_value_get(&flow_values[index]) : "";
+    return (strcmp(value, condition->value) == 0) != condition->negate;
+}
+
+static bool evaluate(int field_index) {
+    const f0_form_field_t *field = &flow_opts->fields[field_index];
+    if (field->show_if.field && !is_condition_met(&field->show_if)) {
+        return false;
+    }
+    if (field->skip_if.field && is_condition_met(&field->skip_if)) {
+        return false;
+    }
+    return true;
+}
+
+static int mark_dependents(int field_index) {
+    const f0_form_field_t *field = &flow_opts->fields[field_index];
+    int num_marked = 0;
+    for (int i = 0; i < field->num_dependents; ++i) {
+        int dependent = field->dependents[i];
+        if (!dirty[dependent]) {
+            dirty[dependent] = true;
+            ++num_marked;
+        }
+    }
+    return num_marked;
+}
+
+/**
+ * Public functions
+ */
+
+bool f0_flow_init(const f0_config_opts *opts, const f0_store_value_t *values) {
+    flow_opts = opts;
+    flow_values = values;
+
+    visible = calloc(opts->num_fields ? opts->num_fields : 1, sizeof(bool));
+    dirty = calloc(opts->num_fields ? opts->num_fields : 1, sizeof(bool));
+    if (!visible || !dirty) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for form flow");
+        return false;
+    }
+
+    /* Conditions only refer to earlier fields, so a single pass in order is enough */
+    for (int i = 0; i < opts->num_fields; ++i) {
+        visible[i] = evaluate(i);
+    }
+    return true;
+}
+
+void f0_flow_update(int field_index) {
+    /* Dependents always come later, so visit them in order until no marked field is left */
+    int num_dirty = mark_dependents(field_index);
+    for (int i = field_index + 1; num_dirty > 0 && i < flow_opts->num_fields; ++i) {
+        if (!dirty[i]) {
+            continue;
+        }
+        dirty[i] = false;
+        --num_dirty;
+
+        bool is_visible = evaluate(i);
+        if (is_visible != visible[i]) {
+            bbx_log(BBX_LOG_LEVEL_VERBOSE, "Field \"%s\" is now %s", flow_opts->fields[i].name, is_visible ? "shown" : "hidden");
+            visible[i] = is_visible;
+            num_dirty += mark_dependents(i);
+        }
+    }
+}
+
+bool f0_flow_is_visible(int field_index) {
+    return visible[field_index];
+}
+
+int f0_flow_next(int field_index) {
+    int i = field_index + 1;
+    while (i < flow_opts->num_fields && !visible[i]) {
+        ++i;
+    }
+    return i;
+}
+
+int f0_flow_prev(int field_index) {
+    int i = field_index - 1;
+    while (i >= 0 && !visible[i]) {
+        --i;
+    }
+    return i;
+}
@@ -0,0 +1,62 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef F0_FLOW_H
+#define F0_FLOW_H
+
+#include "config.h"
+#include "store.h"
+
+#include <stdbool.h>
+
+/**
+ * Form flow
+ *
+ * Tracks which form fields are visible according to their show_if and skip_if conditions. Hidden fields
+ * count as empty when evaluating the conditions of later fields. When a value changes, only the fields
+ * that (transitively) depend on it are re-evaluated.
+ */
+
+/**
+ * Evaluate the visibility of all fields.
+ *
+ * @param opts pointer to the options with resolved fields (must outlive the flow)
+ * @param values field values, one per field (must outlive the flow)
+ * @return true on success, false if memory could not be allocated
+ */
+bool f0_flow_init(const f0_config_opts *opts, const f0_store_value_t *values);
+
+/**
+ * Re-evaluate the fields that depend on a field after its value has changed.
+ *
+ * @param field_index index of the changed field
+ */
+void f0_flow_update(int field_index);
+
+/**
+ * Check whether a field is currently visible.
+ *
+ * @param field_index index of the field
+ * @return true if the field is visible, false otherwise
+ */
+bool f0_flow_is_visible(int field_index);
+
+/**
+ * Find the next visible field.
+ *
+ * @param field_index index of the current field or -1 to find the first visible field
+ * @return index of the next visible field or the number of fields if there is none
+ */
+int f0_flow_next(int field_index);
+
+/**
+ * Find the previous visible field.
+ *
+ * @param field_index index of the current field
+ * @return index of the previous visible field or -1 if there is none
+ */
+int f0_flow_prev(int field_index);
+
+#endif /* F0_FLOW_H */
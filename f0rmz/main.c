@@ -5,13 +5,18 @@
 
 #include "command_line.h"
 #include "config.h"
+#include "flow.h"
+#include "store.h"
+#include "stream.h"
 
 #include "../shared/backends.h"
 #include "../shared/display.h"
+#include "../shared/draw_threads.h"
 #include "../shared/header.h"
 #include "../shared/indev.h"
 #include "../shared/keyboard.h"
 #include "../shared/log.h"
+#include "../shared/memory_display.h"
 #include "../shared/theme.h"
 #include "../shared/themes.h"
 #include "../shared/terminal.h"
@@ -22,6 +27,7 @@
 #include <sys/epoll.h>
 #include <sys/reboot.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -39,8 +45,9 @@ f0_config_opts conf_opts;
 
 bool is_alternate_theme = false;
 bool is_keyboard_hidden = false;
+static volatile sig_atomic_t is_dump_requested = 0;
 
-static char **field_values = NULL;
+static f0_store_value_t *field_values = NULL;
 
 int current_field_index = 0;
 
@@ -256,11 +263,23 @@ static void shutdown(void);
  */
 static void sigaction_handler(int signum);
 
+/**
+ * Handle SIGUSR1, which requests a dump of the memory display.
+ *
+ * @param signum the signal's number
+ */
+static void dump_signal_handler(int signum);
+
 /**
  * Restore the terminal and exit from the program with EXIT_FAILURE.
  */
 static void exit_failure();
 
+/**
+ * Restore the terminal and exit from the program with EXIT_SUCCESS once a replayed input trace has ended.
+ */
+static void replay_finished(void);
+
 /**
  * Static functions
  */
@@ -287,11 +306,21 @@ static void sigaction_handler(int signum) {
     exit(signum);
 }
 
+static void dump_signal_handler(int signum) {
+    LV_UNUSED(signum);
+    is_dump_requested = 1;
+}
+
 static void exit_failure() {
     bbx_terminal_reset_current_terminal();
     exit(EXIT_FAILURE);
 }
 
+static void replay_finished(void) {
+    bbx_terminal_reset_current_terminal();
+    exit(EXIT_SUCCESS);
+}
+
 
 static void toggle_theme(void) {
     is_alternate_theme = !is_alternate_theme;
@@ -354,8 +383,7 @@ static void toggle_password_summary_btn_clicked_cb(lv_event_t *event) {
     if (is_obscured) {
         /* Show actual password - need field index to get real value */
         int field_index = (int)(intptr_t)lv_obj_get_user_data(value_label);
-        const char *real_value = field_values[field_index] ? field_values[field_index] : "";
-        lv_label_set_text(value_label, real_value);
+        lv_label_set_text(value_label, f0_store_value_get(&field_values[field_index]));
         lv_label_set_text(btn_label, LV_SYMBOL_EYE_CLOSE);
     } else {
         lv_label_set_text(value_label, F0_PASSWORD_HIDDEN_DOTS);
@@ -423,14 +451,18 @@ static void keyboard_ready_cb(lv_event_t *event) {
 
 static void get_started_btn_clicked_cb(lv_event_t *event) {
     LV_UNUSED(event);
-    current_field_index = 0;
-    show_form_screen();
+    current_field_index = f0_flow_next(-1);
+    if (current_field_index >= conf_opts.num_fields) {
+        show_summary_screen();
+    } else {
+        show_form_screen();
+    }
 }
 
 static void field_submit_cb(lv_event_t *event) {
     LV_UNUSED(event);
     if (save_and_validate_current_field()) {
-        current_field_index++;
+        current_field_index = f0_flow_next(current_field_index);
         if (current_field_index >= conf_opts.num_fields) {
             show_summary_screen();
         } else {
@@ -441,8 +473,10 @@ static void field_submit_cb(lv_event_t *event) {
 
 static void prev_btn_clicked_cb(lv_event_t *event) {
     LV_UNUSED(event);
-    if (current_field_index > 0 && save_and_validate_current_field()) {
-        current_field_index--;
+    int prev_field_index = f0_flow_prev(current_field_index);
+    if (prev_field_index >= 0 && save_and_validate_current_field()) {
+        /* Saving can only show or hide later fields, so the previous field stays the same */
+        current_field_index = prev_field_index;
         show_form_screen();
     }
 }
@@ -450,7 +484,7 @@ static void prev_btn_clicked_cb(lv_event_t *event) {
 static void next_btn_clicked_cb(lv_event_t *event) {
     LV_UNUSED(event);
     if (save_and_validate_current_field()) {
-        current_field_index++;
+        current_field_index = f0_flow_next(current_field_index);
         if (current_field_index >= conf_opts.num_fields) {
             show_summary_screen();
         } else {
@@ -470,12 +504,18 @@ static void summary_field_clicked_cb(lv_event_t *event) {
 static void finish_cb(lv_event_t *event) {
     LV_UNUSED(event);
 
-    /* Output key=value pairs */
+    /* Output key=value pairs of the fields that are part of the flow */
     for (int i = 0; i < conf_opts.num_fields; i++) {
+        if (!f0_flow_is_visible(i)) {
+            continue;
+        }
         const f0_form_field_t *field = &conf_opts.fields[i];
-        const char *value = field_values[i] ? field_values[i] : "";
-        printf("%s=%s\n", field->name, value);
+        printf("%s=%s\n", field->name, f0_store_value_get(&field_values[i]));
     }
+    fflush(stdout);
+
+    /* Signal end of input to stream readers */
+    f0_stream_close();
 
     /* Clear the screen so that form data cannot leak via stale display buffers */
     lv_obj_t *rect = lv_obj_create(lv_screen_active());
@@ -495,15 +535,15 @@ static bool validate_field(int field_index) {
     if (field_index >= conf_opts.num_fields) return true;
 
     const f0_form_field_t *field = &conf_opts.fields[field_index];
-    const char *value = field_values[field_index] ? field_values[field_index] : "";
+    const f0_store_value_t *value = &field_values[field_index];
 
     // Required field validation
-    if (field->required && strlen(value) == 0) {
+    if (field->required && value->length == 0) {
         return false;
     }
 
     // Future validation rules here, e.g.:
-    // if (field->min_length > 0 && strlen(value) < field->min_length) return false;
+    // if (field->min_length > 0 && value->length < field->min_length) return false;
 
     return true;
 }
@@ -524,18 +564,23 @@ static bool save_and_validate_current_field() {
     if (!form_textarea || !field_values) return true;
 
     // Save current content
-    char *new_value = strdup(lv_textarea_get_text(form_textarea));
-    if (new_value) {
-        if (field_values[current_field_index]) {
-            free(field_values[current_field_index]);
-        }
-        field_values[current_field_index] = new_value;
-    }
+    bool is_changed = false;
+    f0_store_value_set(&field_values[current_field_index], lv_textarea_get_text(form_textarea), &is_changed);
 
     // Validate and show/clear error
     bool is_valid = validate_field(current_field_index);
     set_field_validation_error(!is_valid);
 
+    // Show or hide later fields that depend on the value
+    if (is_changed) {
+        f0_flow_update(current_field_index);
+    }
+
+    // Stream newly committed values so that readers can act on them before the form is finished
+    if (is_valid && is_changed) {
+        f0_stream_write_field(conf_opts.fields[current_field_index].name, f0_store_value_get(&field_values[current_field_index]));
+    }
+
     return is_valid;
 }
 
@@ -597,10 +642,6 @@ static void show_form_screen(void) {
         return;
     }
 
-    if (field_values == NULL) {
-        field_values = calloc(conf_opts.num_fields, sizeof(char*));
-    }
-
     f0_form_field_t *field = &conf_opts.fields[current_field_index];
 
     /* Clear screen */
@@ -676,8 +717,8 @@ static void show_form_screen(void) {
     }
 
     /* Restore saved content */
-    if (field_values[current_field_index]) {
-        lv_textarea_set_text(form_textarea, field_values[current_field_index]);
+    if (field_values[current_field_index].length > 0) {
+        lv_textarea_set_text(form_textarea, field_values[current_field_index].data);
         /* Prevent text from being scrolled off to the left of the textarea */
         lv_obj_update_layout(form_textarea);
         lv_obj_scroll_to_x(form_textarea, 0, LV_ANIM_OFF);
@@ -695,7 +736,7 @@ static void show_form_screen(void) {
     lv_label_set_text(prev_label, "Previous");
     lv_obj_center(prev_label);
     lv_obj_add_event_cb(prev_btn, prev_btn_clicked_cb, LV_EVENT_CLICKED, NULL);
-    if (current_field_index == 0) {
+    if (f0_flow_prev(current_field_index) < 0) {
         lv_obj_add_flag(prev_btn, LV_OBJ_FLAG_HIDDEN);
     } else {
         lv_obj_remove_flag(prev_btn, LV_OBJ_FLAG_HIDDEN);
@@ -709,7 +750,7 @@ static void show_form_screen(void) {
     /* Next button */
     lv_obj_t *next_btn = lv_button_create(nav_container);
     lv_obj_t *next_label = lv_label_create(next_btn);
-    lv_label_set_text(next_label, current_field_index >= conf_opts.num_fields - 1 ? "Submit" : "Next");
+    lv_label_set_text(next_label, f0_flow_next(current_field_index) >= conf_opts.num_fields ? "Submit" : "Next");
     lv_obj_center(next_label);
     lv_obj_add_event_cb(next_btn, next_btn_clicked_cb, LV_EVENT_CLICKED, NULL);
 
@@ -768,8 +809,12 @@ static void show_summary_screen(void) {
 
     /* Field list */
     for (int i = 0; i < conf_opts.num_fields; i++) {
+        if (!f0_flow_is_visible(i)) {
+            continue;
+        }
+
         f0_form_field_t *field = &conf_opts.fields[i];
-        const char *value = field_values[i] ? field_values[i] : "";
+        const f0_store_value_t *value = &field_values[i];
 
         lv_obj_t *item_btn = lv_button_create(container);
         lv_obj_set_width(item_btn, LV_PCT(100));
@@ -786,7 +831,7 @@ static void show_summary_screen(void) {
         lv_obj_set_style_text_decor(label, LV_TEXT_DECOR_UNDERLINE, LV_PART_MAIN);
 
         lv_obj_t *value_label = lv_label_create(item_container);
-        if (strlen(value) > 0) {
+        if (value->length > 0) {
             if (field->type == F0_FIELD_TYPE_PASSWORD) {
                 lv_label_set_text(value_label, F0_PASSWORD_HIDDEN_DOTS);
 
@@ -800,7 +845,7 @@ static void show_summary_screen(void) {
                 lv_obj_center(toggle_label);
                 lv_obj_add_event_cb(toggle_btn, toggle_password_summary_btn_clicked_cb, LV_EVENT_CLICKED, NULL);
             } else {
-                lv_label_set_text(value_label, value);
+                lv_label_set_text(value_label, value->data);
             }
         } else {
             lv_label_set_text(value_label, "(empty)");
@@ -849,6 +894,23 @@ int main(int argc, char *argv[]) {
     f0_config_parse_file("/etc/f0rmz.conf", &conf_opts);
     f0_config_parse_directory("/etc/f0rmz.conf.d", &conf_opts);
     f0_config_parse_file(cli_opts.config_file, &conf_opts);
+    f0_config_resolve_fields(&conf_opts);
+
+    /* Set up field values and the fields that are initially part of the flow */
+    field_values = calloc(conf_opts.num_fields ? conf_opts.num_fields : 1, sizeof(f0_store_value_t));
+    if (!field_values || !f0_flow_init(&conf_opts, field_values)) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for form");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Set up streaming of field values */
+    if (cli_opts.output_fd != -1) {
+        if (fcntl(cli_opts.output_fd, F_GETFD) == -1) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "Output fd %d is not open", cli_opts.output_fd);
+            exit(EXIT_FAILURE);
+        }
+        f0_stream_open(cli_opts.output_fd, cli_opts.output_format);
+    }
 
     /* Prepare current TTY and clean up on termination */
     bbx_terminal_prepare_current_terminal(!conf_opts.quirks.terminal_prevent_graphics_mode, !conf_opts.quirks.terminal_allow_keyboard_input);
@@ -859,7 +921,7 @@ int main(int argc, char *argv[]) {
     sigaction(SIGTERM, &action, NULL);
 
     /* Initialize LVGL */
-    lv_init();
+    bbx_draw_threads_init_lvgl();
     lv_log_register_print_cb(bbx_log_print_cb);
 
     /* Populate display config */
@@ -869,7 +931,9 @@ int main(int argc, char *argv[]) {
         .x_offset = cli_opts.common.x_offset,
         .y_offset = cli_opts.common.y_offset,
         .dpi = cli_opts.common.dpi,
-        .fbdev_force_refresh = conf_opts.quirks.fbdev_force_refresh
+        .fbdev_force_refresh = conf_opts.quirks.fbdev_force_refresh,
+        .memory_file = conf_opts.general.memory_file,
+        .memory_bpp = conf_opts.general.memory_bpp
     };
 
     /* Initialize display */
@@ -878,6 +942,12 @@ int main(int argc, char *argv[]) {
         exit_failure();
     }
 
+    /* Dump the screen of the memory backend on request, e.g. for rendering tests */
+    if (conf_opts.general.backend == BBX_BACKENDS_BACKEND_MEMORY && conf_opts.general.memory_file) {
+        action.sa_handler = dump_signal_handler;
+        sigaction(SIGUSR1, &action, NULL);
+    }
+
     int fd_epoll = epoll_create1(EPOLL_CLOEXEC);
     if (fd_epoll == -1) {
         bbx_log(BBX_LOG_LEVEL_ERROR, "epoll_create1() is failed");
@@ -889,12 +959,16 @@ int main(int argc, char *argv[]) {
         .keymap = &conf_opts.hw_keyboard,
         .keyboard = conf_opts.input.keyboard,
         .pointer = conf_opts.input.pointer,
-        .touchscreen = conf_opts.input.touchscreen
+        .touchscreen = conf_opts.input.touchscreen,
+        .record_path = cli_opts.common.record_input,
+        .replay_path = cli_opts.common.replay_input,
+        .replay_fast = cli_opts.common.replay_fast
     };
     if (bbx_indev_init(fd_epoll, &input_config) == 0)
         exit_failure();
 
     bbx_indev_set_key_power_cb(shutdown);
+    bbx_indev_set_replay_finished_cb(replay_finished);
 
     /* Hide the on-screen keyboard by default if a physical keyboard is connected */
     if (conf_opts.keyboard.autohide && bbx_indev_is_keyboard_connected()) {
@@ -926,8 +1000,13 @@ int main(int argc, char *argv[]) {
             handler();
             continue;
         }
-        if (errno == EINTR)
+        if (errno == EINTR) {
+            if (is_dump_requested) {
+                is_dump_requested = 0;
+                bbx_memory_display_request_dump();
+            }
             continue;
+        }
 
         bbx_log(BBX_LOG_LEVEL_ERROR, "epoll_wait() is failed");
         exit_failure();
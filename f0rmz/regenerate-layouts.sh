@@ -0,0 +1,33 @@
+#!/bin/bash
+
+# Copyright 2021 Johannes Marbach
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+# Additional arguments (e.g. --squeekboard-dir and --cache-dir) are passed on to squeek2lvgl.py. Set
+# SQ2LV_PYTHON to a Python interpreter with PyYAML installed to skip pipenv.
+
+
+cd "$(dirname "${BASH_SOURCE[0]}")/../squeek2lvgl"
+
+if [ -n "$SQ2LV_PYTHON" ]; then
+    squeek2lvgl=("$SQ2LV_PYTHON" squeek2lvgl.py)
+else
+    pipenv install
+    squeek2lvgl=(pipenv run python squeek2lvgl.py)
+fi
+
+"${squeek2lvgl[@]}" \
+    --input us.yaml \
+      --name "US English" \
+    --input de.yaml \
+      --name "Deutsch" \
+    --input es.yaml \
+      --name "Español" \
+    --input fr.yaml \
+      --name "Français" \
+    --extra-top-row-base "1 2 3 4 5 6 7 8 9 0" \
+    --extra-top-row-upper "! @ # $ % ^ & * ( )" \
+    --output ../f0rmz \
+    --surround-space-with-arrows \
+    --shift-keycap '\xef\x8d\x9b' \
+    "$@"
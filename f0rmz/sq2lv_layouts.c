@@ -40,11 +40,11 @@ static const int * const modifier_idxs_lower_us = NULL;
 
 static const int num_switchers_lower_us = 2;
 
-static const int switcher_idxs_lower_us[] = { \
+static const uint16_t switcher_idxs_lower_us[] = { \
     29, 38 \
 };
 
-static const int switcher_dests_lower_us[] = { \
+static const uint16_t switcher_dests_lower_us[] = { \
     1, 2 \
 };
 
@@ -70,15 +70,9 @@ static const lv_buttonmatrix_ctrl_t attributes_upper_us[] = { \
 
 static const int num_modifiers_upper_us = 0;
 
-static const int * const modifier_idxs_upper_us = NULL;
-
 static const int num_switchers_upper_us = 2;
 
-static const int switcher_idxs_upper_us[] = { \
-    29, 38 \
-};
-
-static const int switcher_dests_upper_us[] = { \
+static const uint16_t switcher_dests_upper_us[] = { \
     0, 2 \
 };
 
@@ -104,15 +98,13 @@ static const lv_buttonmatrix_ctrl_t attributes_numbers_us[] = { \
 
 static const int num_modifiers_numbers_us = 0;
 
-static const int * const modifier_idxs_numbers_us = NULL;
-
 static const int num_switchers_numbers_us = 2;
 
-static const int switcher_idxs_numbers_us[] = { \
+static const uint16_t switcher_idxs_numbers_us[] = { \
     21, 30 \
 };
 
-static const int switcher_dests_numbers_us[] = { \
+static const uint16_t switcher_dests_numbers_us[] = { \
     3, 0 \
 };
 
@@ -128,25 +120,11 @@ static const char * const keycaps_symbols_us[] = { \
     "ABC", LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, ".", LV_SYMBOL_OK, "" \
 };
 
-static const lv_buttonmatrix_ctrl_t attributes_symbols_us[] = { \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_HIDDEN | 2, \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, \
-    SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, SQ2LV_CTRL_NON_CHAR | 3, \
-    SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, SQ2LV_CTRL_NON_CHAR | 2, 7, SQ2LV_CTRL_NON_CHAR | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, SQ2LV_CTRL_NON_CHAR | 3 \
-};
-
 static const int num_modifiers_symbols_us = 0;
 
-static const int * const modifier_idxs_symbols_us = NULL;
-
 static const int num_switchers_symbols_us = 2;
 
-static const int switcher_idxs_symbols_us[] = { \
-    21, 30 \
-};
-
-static const int switcher_dests_symbols_us[] = { \
+static const uint16_t switcher_dests_symbols_us[] = { \
     2, 0 \
 };
 
@@ -170,9 +148,9 @@ static const sq2lv_layer_t layers_us[] = {
         .keycaps = keycaps_upper_us,
         .attributes = attributes_upper_us,
         .num_modifiers = num_modifiers_upper_us,
-        .modifier_idxs = modifier_idxs_upper_us,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_upper_us,
-        .switcher_idxs = switcher_idxs_upper_us,
+        .switcher_idxs = switcher_idxs_lower_us,
         .switcher_dests = switcher_dests_upper_us
     },
     {
@@ -180,7 +158,7 @@ static const sq2lv_layer_t layers_us[] = {
         .keycaps = keycaps_numbers_us,
         .attributes = attributes_numbers_us,
         .num_modifiers = num_modifiers_numbers_us,
-        .modifier_idxs = modifier_idxs_numbers_us,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_numbers_us,
         .switcher_idxs = switcher_idxs_numbers_us,
         .switcher_dests = switcher_dests_numbers_us
@@ -188,11 +166,11 @@ static const sq2lv_layer_t layers_us[] = {
     {
         .num_keys = num_keys_symbols_us,
         .keycaps = keycaps_symbols_us,
-        .attributes = attributes_symbols_us,
+        .attributes = attributes_numbers_us,
         .num_modifiers = num_modifiers_symbols_us,
-        .modifier_idxs = modifier_idxs_symbols_us,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_symbols_us,
-        .switcher_idxs = switcher_idxs_symbols_us,
+        .switcher_idxs = switcher_idxs_numbers_us,
         .switcher_dests = switcher_dests_symbols_us
     }
 };
@@ -226,15 +204,13 @@ static const lv_buttonmatrix_ctrl_t attributes_lower_de[] = { \
 
 static const int num_modifiers_lower_de = 0;
 
-static const int * const modifier_idxs_lower_de = NULL;
-
 static const int num_switchers_lower_de = 3;
 
-static const int switcher_idxs_lower_de[] = { \
+static const uint16_t switcher_idxs_lower_de[] = { \
     29, 38, 39 \
 };
 
-static const int switcher_dests_lower_de[] = { \
+static const uint16_t switcher_dests_lower_de[] = { \
     1, 2, 4 \
 };
 
@@ -260,15 +236,9 @@ static const lv_buttonmatrix_ctrl_t attributes_upper_de[] = { \
 
 static const int num_modifiers_upper_de = 0;
 
-static const int * const modifier_idxs_upper_de = NULL;
-
 static const int num_switchers_upper_de = 3;
 
-static const int switcher_idxs_upper_de[] = { \
-    29, 38, 39 \
-};
-
-static const int switcher_dests_upper_de[] = { \
+static const uint16_t switcher_dests_upper_de[] = { \
     0, 2, 4 \
 };
 
@@ -294,15 +264,13 @@ static const lv_buttonmatrix_ctrl_t attributes_numbers_de[] = { \
 
 static const int num_modifiers_numbers_de = 0;
 
-static const int * const modifier_idxs_numbers_de = NULL;
-
 static const int num_switchers_numbers_de = 3;
 
-static const int switcher_idxs_numbers_de[] = { \
+static const uint16_t switcher_idxs_numbers_de[] = { \
     21, 30, 31 \
 };
 
-static const int switcher_dests_numbers_de[] = { \
+static const uint16_t switcher_dests_numbers_de[] = { \
     3, 0, 4 \
 };
 
@@ -318,25 +286,11 @@ static const char * const keycaps_symbols_de[] = { \
     "abc", "äÄ", LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, ",", ".", LV_SYMBOL_OK, "" \
 };
 
-static const lv_buttonmatrix_ctrl_t attributes_symbols_de[] = { \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_HIDDEN | 2, \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, \
-    SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, SQ2LV_CTRL_NON_CHAR | 3, \
-    SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, SQ2LV_CTRL_MOD_INACTIVE | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, SQ2LV_CTRL_NON_CHAR | 2, 7, SQ2LV_CTRL_NON_CHAR | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, SQ2LV_CTRL_NON_CHAR | 3 \
-};
-
 static const int num_modifiers_symbols_de = 0;
 
-static const int * const modifier_idxs_symbols_de = NULL;
-
 static const int num_switchers_symbols_de = 3;
 
-static const int switcher_idxs_symbols_de[] = { \
-    21, 30, 31 \
-};
-
-static const int switcher_dests_symbols_de[] = { \
+static const uint16_t switcher_dests_symbols_de[] = { \
     2, 0, 4 \
 };
 
@@ -362,15 +316,9 @@ static const lv_buttonmatrix_ctrl_t attributes_special_de[] = { \
 
 static const int num_modifiers_special_de = 0;
 
-static const int * const modifier_idxs_special_de = NULL;
-
 static const int num_switchers_special_de = 3;
 
-static const int switcher_idxs_special_de[] = { \
-    21, 30, 31 \
-};
-
-static const int switcher_dests_special_de[] = { \
+static const uint16_t switcher_dests_special_de[] = { \
     2, 0, 0 \
 };
 
@@ -384,7 +332,7 @@ static const sq2lv_layer_t layers_de[] = {
         .keycaps = keycaps_lower_de,
         .attributes = attributes_lower_de,
         .num_modifiers = num_modifiers_lower_de,
-        .modifier_idxs = modifier_idxs_lower_de,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_lower_de,
         .switcher_idxs = switcher_idxs_lower_de,
         .switcher_dests = switcher_dests_lower_de
@@ -394,9 +342,9 @@ static const sq2lv_layer_t layers_de[] = {
         .keycaps = keycaps_upper_de,
         .attributes = attributes_upper_de,
         .num_modifiers = num_modifiers_upper_de,
-        .modifier_idxs = modifier_idxs_upper_de,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_upper_de,
-        .switcher_idxs = switcher_idxs_upper_de,
+        .switcher_idxs = switcher_idxs_lower_de,
         .switcher_dests = switcher_dests_upper_de
     },
     {
@@ -404,7 +352,7 @@ static const sq2lv_layer_t layers_de[] = {
         .keycaps = keycaps_numbers_de,
         .attributes = attributes_numbers_de,
         .num_modifiers = num_modifiers_numbers_de,
-        .modifier_idxs = modifier_idxs_numbers_de,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_numbers_de,
         .switcher_idxs = switcher_idxs_numbers_de,
         .switcher_dests = switcher_dests_numbers_de
@@ -412,11 +360,11 @@ static const sq2lv_layer_t layers_de[] = {
     {
         .num_keys = num_keys_symbols_de,
         .keycaps = keycaps_symbols_de,
-        .attributes = attributes_symbols_de,
+        .attributes = attributes_numbers_de,
         .num_modifiers = num_modifiers_symbols_de,
-        .modifier_idxs = modifier_idxs_symbols_de,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_symbols_de,
-        .switcher_idxs = switcher_idxs_symbols_de,
+        .switcher_idxs = switcher_idxs_numbers_de,
         .switcher_dests = switcher_dests_symbols_de
     },
     {
@@ -424,9 +372,9 @@ static const sq2lv_layer_t layers_de[] = {
         .keycaps = keycaps_special_de,
         .attributes = attributes_special_de,
         .num_modifiers = num_modifiers_special_de,
-        .modifier_idxs = modifier_idxs_special_de,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_special_de,
-        .switcher_idxs = switcher_idxs_special_de,
+        .switcher_idxs = switcher_idxs_numbers_de,
         .switcher_dests = switcher_dests_special_de
     }
 };
@@ -460,18 +408,12 @@ static const lv_buttonmatrix_ctrl_t attributes_lower_es[] = { \
 
 static const int num_modifiers_lower_es = 0;
 
-static const int * const modifier_idxs_lower_es = NULL;
-
 static const int num_switchers_lower_es = 3;
 
-static const int switcher_idxs_lower_es[] = { \
+static const uint16_t switcher_idxs_lower_es[] = { \
     30, 39, 40 \
 };
 
-static const int switcher_dests_lower_es[] = { \
-    1, 2, 4 \
-};
-
 /* Layer: Uppercase letters - generated from upper */
 
 static const int num_keys_upper_es = 47;
@@ -494,18 +436,8 @@ static const lv_buttonmatrix_ctrl_t attributes_upper_es[] = { \
 
 static const int num_modifiers_upper_es = 0;
 
-static const int * const modifier_idxs_upper_es = NULL;
-
 static const int num_switchers_upper_es = 3;
 
-static const int switcher_idxs_upper_es[] = { \
-    30, 39, 40 \
-};
-
-static const int switcher_dests_upper_es[] = { \
-    0, 2, 4 \
-};
-
 /* Layer: Numbers / symbols - generated from numbers */
 
 static const int num_keys_numbers_es = 38;
@@ -518,28 +450,10 @@ static const char * const keycaps_numbers_es[] = { \
     "abc", "áÁ", LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, "?", ".", LV_SYMBOL_OK, "" \
 };
 
-static const lv_buttonmatrix_ctrl_t attributes_numbers_es[] = { \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_HIDDEN | 2, \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, \
-    SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, SQ2LV_CTRL_NON_CHAR | 3, \
-    SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, SQ2LV_CTRL_MOD_INACTIVE | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, SQ2LV_CTRL_NON_CHAR | 2, 7, SQ2LV_CTRL_NON_CHAR | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, SQ2LV_CTRL_NON_CHAR | 3 \
-};
-
 static const int num_modifiers_numbers_es = 0;
 
-static const int * const modifier_idxs_numbers_es = NULL;
-
 static const int num_switchers_numbers_es = 3;
 
-static const int switcher_idxs_numbers_es[] = { \
-    21, 30, 31 \
-};
-
-static const int switcher_dests_numbers_es[] = { \
-    3, 0, 4 \
-};
-
 /* Layer: Symbols - generated from symbols */
 
 static const int num_keys_symbols_es = 38;
@@ -552,28 +466,10 @@ static const char * const keycaps_symbols_es[] = { \
     "abc", "áÁ", LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, "?", ".", LV_SYMBOL_OK, "" \
 };
 
-static const lv_buttonmatrix_ctrl_t attributes_symbols_es[] = { \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_HIDDEN | 2, \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, \
-    SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, SQ2LV_CTRL_NON_CHAR | 3, \
-    SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, SQ2LV_CTRL_MOD_INACTIVE | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, SQ2LV_CTRL_NON_CHAR | 2, 7, SQ2LV_CTRL_NON_CHAR | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, SQ2LV_CTRL_NON_CHAR | 3 \
-};
-
 static const int num_modifiers_symbols_es = 0;
 
-static const int * const modifier_idxs_symbols_es = NULL;
-
 static const int num_switchers_symbols_es = 3;
 
-static const int switcher_idxs_symbols_es[] = { \
-    21, 30, 31 \
-};
-
-static const int switcher_dests_symbols_es[] = { \
-    2, 0, 4 \
-};
-
 /* Layer: Special characters - generated from eschars */
 
 static const int num_keys_special_es = 38;
@@ -586,28 +482,10 @@ static const char * const keycaps_special_es[] = { \
     "abc", "áÁ", LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, "«", "»", LV_SYMBOL_OK, "" \
 };
 
-static const lv_buttonmatrix_ctrl_t attributes_special_es[] = { \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_HIDDEN | 2, \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, \
-    SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, SQ2LV_CTRL_NON_CHAR | 3, \
-    SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, SQ2LV_CTRL_MOD_ACTIVE | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, SQ2LV_CTRL_NON_CHAR | 2, 7, SQ2LV_CTRL_NON_CHAR | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, SQ2LV_CTRL_NON_CHAR | 3 \
-};
-
 static const int num_modifiers_special_es = 0;
 
-static const int * const modifier_idxs_special_es = NULL;
-
 static const int num_switchers_special_es = 3;
 
-static const int switcher_idxs_special_es[] = { \
-    21, 30, 31 \
-};
-
-static const int switcher_dests_special_es[] = { \
-    2, 0, 0 \
-};
-
 /* Layer array */
 
 static const int num_layers_es = 5;
@@ -618,50 +496,50 @@ static const sq2lv_layer_t layers_es[] = {
         .keycaps = keycaps_lower_es,
         .attributes = attributes_lower_es,
         .num_modifiers = num_modifiers_lower_es,
-        .modifier_idxs = modifier_idxs_lower_es,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_lower_es,
         .switcher_idxs = switcher_idxs_lower_es,
-        .switcher_dests = switcher_dests_lower_es
+        .switcher_dests = switcher_dests_lower_de
     },
     {
         .num_keys = num_keys_upper_es,
         .keycaps = keycaps_upper_es,
         .attributes = attributes_upper_es,
         .num_modifiers = num_modifiers_upper_es,
-        .modifier_idxs = modifier_idxs_upper_es,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_upper_es,
-        .switcher_idxs = switcher_idxs_upper_es,
-        .switcher_dests = switcher_dests_upper_es
+        .switcher_idxs = switcher_idxs_lower_es,
+        .switcher_dests = switcher_dests_upper_de
     },
     {
         .num_keys = num_keys_numbers_es,
         .keycaps = keycaps_numbers_es,
-        .attributes = attributes_numbers_es,
+        .attributes = attributes_numbers_de,
         .num_modifiers = num_modifiers_numbers_es,
-        .modifier_idxs = modifier_idxs_numbers_es,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_numbers_es,
-        .switcher_idxs = switcher_idxs_numbers_es,
-        .switcher_dests = switcher_dests_numbers_es
+        .switcher_idxs = switcher_idxs_numbers_de,
+        .switcher_dests = switcher_dests_numbers_de
     },
     {
         .num_keys = num_keys_symbols_es,
         .keycaps = keycaps_symbols_es,
-        .attributes = attributes_symbols_es,
+        .attributes = attributes_numbers_de,
         .num_modifiers = num_modifiers_symbols_es,
-        .modifier_idxs = modifier_idxs_symbols_es,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_symbols_es,
-        .switcher_idxs = switcher_idxs_symbols_es,
-        .switcher_dests = switcher_dests_symbols_es
+        .switcher_idxs = switcher_idxs_numbers_de,
+        .switcher_dests = switcher_dests_symbols_de
     },
     {
         .num_keys = num_keys_special_es,
         .keycaps = keycaps_special_es,
-        .attributes = attributes_special_es,
+        .attributes = attributes_special_de,
         .num_modifiers = num_modifiers_special_es,
-        .modifier_idxs = modifier_idxs_special_es,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_special_es,
-        .switcher_idxs = switcher_idxs_special_es,
-        .switcher_dests = switcher_dests_special_es
+        .switcher_idxs = switcher_idxs_numbers_de,
+        .switcher_dests = switcher_dests_special_de
     }
 };
 
@@ -694,18 +572,12 @@ static const lv_buttonmatrix_ctrl_t attributes_lower_fr[] = { \
 
 static const int num_modifiers_lower_fr = 0;
 
-static const int * const modifier_idxs_lower_fr = NULL;
-
 static const int num_switchers_lower_fr = 3;
 
-static const int switcher_idxs_lower_fr[] = { \
+static const uint16_t switcher_idxs_lower_fr[] = { \
     30, 39, 43 \
 };
 
-static const int switcher_dests_lower_fr[] = { \
-    1, 2, 4 \
-};
-
 /* Layer: Uppercase letters - generated from upper */
 
 static const int num_keys_upper_fr = 45;
@@ -728,18 +600,8 @@ static const lv_buttonmatrix_ctrl_t attributes_upper_fr[] = { \
 
 static const int num_modifiers_upper_fr = 0;
 
-static const int * const modifier_idxs_upper_fr = NULL;
-
 static const int num_switchers_upper_fr = 3;
 
-static const int switcher_idxs_upper_fr[] = { \
-    30, 39, 43 \
-};
-
-static const int switcher_dests_upper_fr[] = { \
-    0, 2, 4 \
-};
-
 /* Layer: Numbers / symbols - generated from numbers */
 
 static const int num_keys_numbers_fr = 36;
@@ -762,18 +624,12 @@ static const lv_buttonmatrix_ctrl_t attributes_numbers_fr[] = { \
 
 static const int num_modifiers_numbers_fr = 0;
 
-static const int * const modifier_idxs_numbers_fr = NULL;
-
 static const int num_switchers_numbers_fr = 3;
 
-static const int switcher_idxs_numbers_fr[] = { \
+static const uint16_t switcher_idxs_numbers_fr[] = { \
     21, 30, 34 \
 };
 
-static const int switcher_dests_numbers_fr[] = { \
-    3, 0, 4 \
-};
-
 /* Layer: Symbols - generated from symbols */
 
 static const int num_keys_symbols_fr = 36;
@@ -786,28 +642,10 @@ static const char * const keycaps_symbols_fr[] = { \
     "abc", LV_SYMBOL_LEFT, " ", LV_SYMBOL_RIGHT, "âÂ", LV_SYMBOL_OK, "" \
 };
 
-static const lv_buttonmatrix_ctrl_t attributes_symbols_fr[] = { \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_HIDDEN | 2, \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, \
-    LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, \
-    SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, LV_BUTTONMATRIX_CTRL_POPOVER | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 2, SQ2LV_CTRL_NON_CHAR | 3, \
-    SQ2LV_CTRL_NON_CHAR | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, SQ2LV_CTRL_NON_CHAR | 2, 7, SQ2LV_CTRL_NON_CHAR | 2, SQ2LV_CTRL_MOD_INACTIVE | LV_BUTTONMATRIX_CTRL_NO_REPEAT | 3, SQ2LV_CTRL_NON_CHAR | 3 \
-};
-
 static const int num_modifiers_symbols_fr = 0;
 
-static const int * const modifier_idxs_symbols_fr = NULL;
-
 static const int num_switchers_symbols_fr = 3;
 
-static const int switcher_idxs_symbols_fr[] = { \
-    21, 30, 34 \
-};
-
-static const int switcher_dests_symbols_fr[] = { \
-    2, 0, 4 \
-};
-
 /* Layer: Special characters - generated from eschars */
 
 static const int num_keys_special_fr = 36;
@@ -830,18 +668,8 @@ static const lv_buttonmatrix_ctrl_t attributes_special_fr[] = { \
 
 static const int num_modifiers_special_fr = 0;
 
-static const int * const modifier_idxs_special_fr = NULL;
-
 static const int num_switchers_special_fr = 3;
 
-static const int switcher_idxs_special_fr[] = { \
-    21, 30, 34 \
-};
-
-static const int switcher_dests_special_fr[] = { \
-    2, 0, 0 \
-};
-
 /* Layer array */
 
 static const int num_layers_fr = 5;
@@ -852,50 +680,50 @@ static const sq2lv_layer_t layers_fr[] = {
         .keycaps = keycaps_lower_fr,
         .attributes = attributes_lower_fr,
         .num_modifiers = num_modifiers_lower_fr,
-        .modifier_idxs = modifier_idxs_lower_fr,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_lower_fr,
         .switcher_idxs = switcher_idxs_lower_fr,
-        .switcher_dests = switcher_dests_lower_fr
+        .switcher_dests = switcher_dests_lower_de
     },
     {
         .num_keys = num_keys_upper_fr,
         .keycaps = keycaps_upper_fr,
         .attributes = attributes_upper_fr,
         .num_modifiers = num_modifiers_upper_fr,
-        .modifier_idxs = modifier_idxs_upper_fr,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_upper_fr,
-        .switcher_idxs = switcher_idxs_upper_fr,
-        .switcher_dests = switcher_dests_upper_fr
+        .switcher_idxs = switcher_idxs_lower_fr,
+        .switcher_dests = switcher_dests_upper_de
     },
     {
         .num_keys = num_keys_numbers_fr,
         .keycaps = keycaps_numbers_fr,
         .attributes = attributes_numbers_fr,
         .num_modifiers = num_modifiers_numbers_fr,
-        .modifier_idxs = modifier_idxs_numbers_fr,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_numbers_fr,
         .switcher_idxs = switcher_idxs_numbers_fr,
-        .switcher_dests = switcher_dests_numbers_fr
+        .switcher_dests = switcher_dests_numbers_de
     },
     {
         .num_keys = num_keys_symbols_fr,
         .keycaps = keycaps_symbols_fr,
-        .attributes = attributes_symbols_fr,
+        .attributes = attributes_numbers_fr,
         .num_modifiers = num_modifiers_symbols_fr,
-        .modifier_idxs = modifier_idxs_symbols_fr,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_symbols_fr,
-        .switcher_idxs = switcher_idxs_symbols_fr,
-        .switcher_dests = switcher_dests_symbols_fr
+        .switcher_idxs = switcher_idxs_numbers_fr,
+        .switcher_dests = switcher_dests_symbols_de
     },
     {
         .num_keys = num_keys_special_fr,
         .keycaps = keycaps_special_fr,
         .attributes = attributes_special_fr,
         .num_modifiers = num_modifiers_special_fr,
-        .modifier_idxs = modifier_idxs_special_fr,
+        .modifier_idxs = modifier_idxs_lower_us,
         .num_switchers = num_switchers_special_fr,
-        .switcher_idxs = switcher_idxs_special_fr,
-        .switcher_dests = switcher_dests_special_fr
+        .switcher_idxs = switcher_idxs_numbers_fr,
+        .switcher_dests = switcher_dests_special_de
     }
 };
 
@@ -33,9 +33,9 @@ typedef struct {
     /* Number of buttons that trigger a layer switch */
     const int num_switchers;
     /* Button indexes that trigger a layer switch */
-    const int * const switcher_idxs;
+    const uint16_t * const switcher_idxs;
     /* Indexes of layers to jump to when triggering layer switch buttons */
-    const int * const switcher_dests;
+    const uint16_t * const switcher_dests;
 } sq2lv_layer_t;
 
 /* Layout type */
@@ -0,0 +1,97 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "store.h"
+
+#include "../shared/log.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define F0_STORE_CHUNK_SIZE 4096
+#define F0_STORE_MIN_VALUE_CAPACITY 32
+
+struct f0_store_chunk {
+    /* Previously filled chunk */
+    struct f0_store_chunk *next;
+    /* Number of bytes handed out */
+    size_t used;
+    /* Number of usable bytes in data */
+    size_t size;
+    char data[];
+};
+
+/**
+ * Public functions
+ */
+
+void f0_store_arena_init(f0_store_arena_t *arena) {
+    arena->chunks = NULL;
+}
+
+char *f0_store_arena_strdup(f0_store_arena_t *arena, const char *string) {
+    size_t length = strlen(string) + 1;
+
+    f0_store_chunk *chunk = arena->chunks;
+    if (!chunk || chunk->size - chunk->used < length) {
+        /* Oversized strings get a chunk of their own */
+        size_t size = length > F0_STORE_CHUNK_SIZE ? length : F0_STORE_CHUNK_SIZE;
+        chunk = malloc(sizeof(f0_store_chunk) + size);
+        if (!chunk) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for form strings");
+            return NULL;
+        }
+        chunk->next = arena->chunks;
+        chunk->used = 0;
+        chunk->size = size;
+        arena->chunks = chunk;
+    }
+
+    char *copy = chunk->data + chunk->used;
+    memcpy(copy, string, length);
+    chunk->used += length;
+    return copy;
+}
+
+bool f0_store_value_set(f0_store_value_t *value, const char *string, bool *is_changed) {
+    size_t length = strlen(string);
+
+    *is_changed = !value->data || length != value->length || memcmp(value->data, string, length) != 0;
+    if (!*is_changed) {
+        return true;
+    }
+
+    if (length >= value->capacity) {
+        size_t capacity = value->capacity ? value->capacity : F0_STORE_MIN_VALUE_CAPACITY;
+        while (capacity <= length) {
+            capacity *= 2;
+        }
+
+        /* Don't use realloc so that the previous value (which may be a password) can be wiped */
+        char *data = malloc(capacity);
+        if (!data) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for field value");
+            *is_changed = false;
+            return false;
+        }
+        if (value->data) {
+            explicit_bzero(value->data, value->capacity);
+            free(value->data);
+        }
+        value->data = data;
+        value->capacity = capacity;
+    } else if (length < value->length) {
+        /* Don't leave the tail of a longer previous value behind */
+        explicit_bzero(value->data + length, value->length - length);
+    }
+
+    memcpy(value->data, string, length + 1);
+    value->length = length;
+    return true;
+}
+
+const char *f0_store_value_get(const f0_store_value_t *value) {
+    return value->data ? value->data : "";
+}
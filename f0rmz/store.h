@@ -0,0 +1,79 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef F0_STORE_H
+#define F0_STORE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * Field storage
+ *
+ * Strings parsed from the configuration (field names, labels, ...) are copied into an arena that lives as
+ * long as the form, so that large forms don't cause one heap allocation per string. Field values are kept
+ * in growable buffers that are reused when the value is edited again.
+ */
+
+/**
+ * Chunk of arena memory
+ */
+typedef struct f0_store_chunk f0_store_chunk;
+
+/**
+ * Bump allocator for strings
+ */
+typedef struct {
+    /* Chunk that is currently allocated from, linked to the previous ones */
+    f0_store_chunk *chunks;
+} f0_store_arena_t;
+
+/**
+ * Growable buffer for a field value
+ */
+typedef struct {
+    /* NUL-terminated value or NULL if no value has been saved yet */
+    char *data;
+    /* Length of the value excluding the NUL terminator */
+    size_t length;
+    /* Size of the allocated buffer */
+    size_t capacity;
+} f0_store_value_t;
+
+/**
+ * Initialise an empty arena.
+ *
+ * @param arena pointer to the arena
+ */
+void f0_store_arena_init(f0_store_arena_t *arena);
+
+/**
+ * Copy a string into an arena.
+ *
+ * @param arena pointer to the arena
+ * @param string string to copy
+ * @return pointer to the copy (valid as long as the arena) or NULL if memory could not be allocated
+ */
+char *f0_store_arena_strdup(f0_store_arena_t *arena, const char *string);
+
+/**
+ * Save a value into a buffer, reusing its memory if the value fits.
+ *
+ * @param value pointer to the value buffer
+ * @param string new value
+ * @param is_changed pointer to write whether the saved value differs from the previous one into
+ * @return true on success, false if memory could not be allocated (the previous value is kept)
+ */
+bool f0_store_value_set(f0_store_value_t *value, const char *string, bool *is_changed);
+
+/**
+ * Get the saved value of a buffer.
+ *
+ * @param value pointer to the value buffer
+ * @return the value or an empty string if no value has been saved yet
+ */
+const char *f0_store_value_get(const f0_store_value_t *value);
+
+#endif /* F0_STORE_H */
@@ -0,0 +1,191 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "stream.h"
+
+#include "../shared/log.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/**
+ * Static variables
+ */
+
+static int stream_fd = -1;
+static f0_stream_format_t stream_format = F0_STREAM_FORMAT_JSONL;
+
+/**
+ * Static prototypes
+ */
+
+/**
+ * Append a string to a buffer as the contents of a JSON string literal (without quotes).
+ *
+ * @param buf buffer to write into, or NULL to only compute the length
+ * @param string string to escape
+ * @return number of bytes written (or that would have been written)
+ */
+static size_t append_json_escaped(char *buf, const char *string);
+
+/**
+ * Write a buffer to the stream file descriptor in full.
+ *
+ * @param buf data to write
+ * @param len number of bytes to write
+ * @return true on success, false otherwise
+ */
+static bool write_all(const char *buf, size_t len);
+
+/**
+ * Static functions
+ */
+
+static size_t append_json_escaped(char *buf, const char *string) {
+    size_t len = 0;
+    for (const unsigned char *c = (const unsigned char *)string; *c; ++c) {
+        char escaped[7];
+        size_t n;
+
+        switch (*c) {
+        case '"':  n = 2; memcpy(escaped, "\\\"", 2); break;
+        case '\\': n = 2; memcpy(escaped, "\\\\", 2); break;
+        case '\b': n = 2; memcpy(escaped, "\\b", 2); break;
+        case '\f': n = 2; memcpy(escaped, "\\f", 2); break;
+        case '\n': n = 2; memcpy(escaped, "\\n", 2); break;
+        case '\r': n = 2; memcpy(escaped, "\\r", 2); break;
+        case '\t': n = 2; memcpy(escaped, "\\t", 2); break;
+        default:
+            if (*c < 0x20 || *c == 0x7f) {
+                n = 6;
+                snprintf(escaped, sizeof(escaped), "\\u%04x", *c);
+            } else {
+                /* Pass through printable ASCII and UTF-8 sequences unchanged */
+                n = 1;
+                escaped[0] = (char)*c;
+            }
+            break;
+        }
+
+        if (buf) {
+            memcpy(buf + len, escaped, n);
+        }
+        len += n;
+    }
+    return len;
+}
+
+static bool write_all(const char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t r = write(stream_fd, buf, len);
+        if (r < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        buf += r;
+        len -= r;
+    }
+    return true;
+}
+
+/**
+ * Public functions
+ */
+
+bool f0_stream_find_format_with_name(const char *name, f0_stream_format_t *format) {
+    if (strcmp(name, "jsonl") == 0) {
+        *format = F0_STREAM_FORMAT_JSONL;
+        return true;
+    }
+    if (strcmp(name, "nul") == 0) {
+        *format = F0_STREAM_FORMAT_NUL;
+        return true;
+    }
+    return false;
+}
+
+void f0_stream_open(int fd, f0_stream_format_t format) {
+    /* Do not leak the stream into child processes */
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+    /* A reader closing its end must surface as EPIPE rather than kill us before the terminal is restored */
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = SIG_IGN;
+    sigaction(SIGPIPE, &action, NULL);
+
+    stream_fd = fd;
+    stream_format = format;
+}
+
+bool f0_stream_write_field(const char *name, const char *value) {
+    if (stream_fd == -1) {
+        return true;
+    }
+
+    /* Assemble the whole record first so that it is emitted with a single write where possible */
+    size_t len;
+    if (stream_format == F0_STREAM_FORMAT_JSONL) {
+        len = strlen("{\"name\":\"\",\"value\":\"\"}\n") + append_json_escaped(NULL, name) + append_json_escaped(NULL, value);
+    } else {
+        len = strlen(name) + 1 + strlen(value) + 1; /* +1 for separator and NUL terminator, respectively */
+    }
+
+    char *record = malloc(len);
+    if (!record) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for stream record");
+        return false;
+    }
+
+    size_t pos = 0;
+    if (stream_format == F0_STREAM_FORMAT_JSONL) {
+        memcpy(record + pos, "{\"name\":\"", 9);
+        pos += 9;
+        pos += append_json_escaped(record + pos, name);
+        memcpy(record + pos, "\",\"value\":\"", 11);
+        pos += 11;
+        pos += append_json_escaped(record + pos, value);
+        memcpy(record + pos, "\"}\n", 3);
+        pos += 3;
+    } else {
+        size_t name_length = strlen(name);
+        size_t value_length = strlen(value);
+        memcpy(record + pos, name, name_length);
+        pos += name_length;
+        record[pos++] = '=';
+        memcpy(record + pos, value, value_length);
+        pos += value_length;
+        record[pos++] = '\0';
+    }
+
+    bool ok = write_all(record, pos);
+    if (!ok) {
+        /* The reader is most likely gone, so don't keep failing on every later save */
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not write record for field %s to stream, disabling streaming: %s",
+            name, strerror(errno));
+        f0_stream_close();
+    }
+
+    /* Records may contain passwords */
+    explicit_bzero(record, len);
+    free(record);
+
+    return ok;
+}
+
+void f0_stream_close(void) {
+    if (stream_fd == -1) {
+        return;
+    }
+    close(stream_fd);
+    stream_fd = -1;
+}
@@ -0,0 +1,54 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef F0_STREAM_H
+#define F0_STREAM_H
+
+#include <stdbool.h>
+
+/**
+ * Record formats for streamed field values
+ */
+typedef enum {
+    /* One JSON object per line: {"name":"...","value":"..."} */
+    F0_STREAM_FORMAT_JSONL,
+    /* One name=value record per field, terminated by a NUL byte */
+    F0_STREAM_FORMAT_NUL
+} f0_stream_format_t;
+
+/**
+ * Find a stream format by name.
+ *
+ * @param name format name ("jsonl" or "nul")
+ * @param format pointer to write the format into if it was found
+ * @return true if the name matched a format, false otherwise
+ */
+bool f0_stream_find_format_with_name(const char *name, f0_stream_format_t *format);
+
+/**
+ * Start streaming committed field values to a file descriptor. SIGPIPE is ignored from now on so that a reader
+ * going away only fails the write.
+ *
+ * @param fd file descriptor to write records to (owned by the stream from now on)
+ * @param format record format
+ */
+void f0_stream_open(int fd, f0_stream_format_t format);
+
+/**
+ * Write a single field record to the stream. Does nothing if no stream is open. On write errors, the stream is
+ * closed and later records are dropped.
+ *
+ * @param name field name
+ * @param value field value
+ * @return true on success or if no stream is open, false on write errors
+ */
+bool f0_stream_write_field(const char *name, const char *value);
+
+/**
+ * Close the stream, signalling end of input to the reader.
+ */
+void f0_stream_close(void);
+
+#endif /* F0_STREAM_H */
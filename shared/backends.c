@@ -17,6 +17,7 @@ static const char *backends[] = {
 #if LV_USE_LINUX_DRM
     "drm",
 #endif
+    "memory",
     NULL
 };
 
@@ -30,3 +31,23 @@ bbx_backends_backend_id_t bbx_backends_find_backend_with_name(const char *name)
     bbx_log(BBX_LOG_LEVEL_WARNING, "Backend %s not found\n", name);
     return BBX_BACKENDS_BACKEND_NONE;
 }
+
+bool bbx_backends_parse_backend_option(const char *value, void *result) {
+    bbx_backends_backend_id_t id = bbx_backends_find_backend_with_name(value);
+    if (id == BBX_BACKENDS_BACKEND_NONE) {
+        return false;
+    }
+    *(bbx_backends_backend_id_t *)result = id;
+    return true;
+}
+
+bool bbx_backends_parse_memory_bpp_option(const char *value, void *result) {
+    if (strcmp(value, "16") == 0) {
+        *(int *)result = 16;
+    } else if (strcmp(value, "32") == 0) {
+        *(int *)result = 32;
+    } else {
+        return false;
+    }
+    return true;
+}
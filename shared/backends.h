@@ -9,6 +9,8 @@
 
 #include "lv_conf.h"
 
+#include <stdbool.h>
+
 #if LV_USE_LINUX_FBDEV == 0 && LV_USE_LINUX_DRM == 0
 #error Neither of graphical backends is enabled
 #endif
@@ -26,6 +28,7 @@ typedef enum {
 #if LV_USE_LINUX_DRM
     BBX_BACKENDS_BACKEND_DRM,
 #endif
+    BBX_BACKENDS_BACKEND_MEMORY,
 } bbx_backends_backend_id_t;
 
 /**
@@ -36,4 +39,22 @@ typedef enum {
  */
 bbx_backends_backend_id_t bbx_backends_find_backend_with_name(const char *name);
 
+/**
+ * Parse a backend option value.
+ *
+ * @param value backend name
+ * @param result pointer to a bbx_backends_backend_id_t to write the backend into if parsing is successful
+ * @return true on success, false otherwise
+ */
+bool bbx_backends_parse_backend_option(const char *value, void *result);
+
+/**
+ * Parse the bits per pixel of the memory backend.
+ *
+ * @param value 16 or 32
+ * @param result pointer to an int to write the bits per pixel into if parsing is successful
+ * @return true on success, false otherwise
+ */
+bool bbx_backends_parse_memory_bpp_option(const char *value, void *result);
+
 #endif /* BBX_BACKENDS_H */
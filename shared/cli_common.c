@@ -20,6 +20,9 @@ void bbx_cli_init_common_opts(bbx_cli_common_opts *opts) {
     opts->y_offset = 0;
     opts->dpi = 0;
     opts->verbose = false;
+    opts->record_input = NULL;
+    opts->replay_input = NULL;
+    opts->replay_fast = false;
 }
 
 int bbx_cli_parse_geometry(const char *optarg, bbx_cli_common_opts *opts) {
@@ -21,8 +21,23 @@ typedef struct {
     int dpi;
     /* Verbose logging */
     bool verbose;
+    /* Path to record input events to or NULL */
+    const char *record_input;
+    /* Path of an input trace to replay or NULL */
+    const char *replay_input;
+    /* Replay input as fast as possible */
+    bool replay_fast;
 } bbx_cli_common_opts;
 
+/**
+ * Values returned by getopt_long for common options that only have a long form
+ */
+enum {
+    BBX_CLI_OPT_RECORD_INPUT = 0x100,
+    BBX_CLI_OPT_REPLAY_INPUT,
+    BBX_CLI_OPT_REPLAY_FAST
+};
+
 /**
  * Initialize common CLI options with default values.
  *
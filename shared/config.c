@@ -7,8 +7,11 @@
 #include "config.h"
 
 #include "log.h"
+#include "themes.h"
 
+#include <assert.h>
 #include <dirent.h>
+#include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -26,6 +29,17 @@
  */
 static bool string_ends_with(const char *string, const char *suffix);
 
+/**
+ * Order an option relative to a section and key.
+ *
+ * @param option option to compare
+ * @param section section name
+ * @param key option key
+ * @return a positive integer if the option sorts after section and key, a negative integer if it sorts
+ * before and 0 if they are equal
+ */
+static int compare_option(const bbx_config_option *option, const char *section, const char *key);
+
 
 /**
  * Static functions
@@ -38,6 +52,11 @@ static bool string_ends_with(const char *string, const char *suffix) {
     return strncmp(string + strlen(string) - strlen(suffix), suffix, strlen(suffix)) == 0;
 }
 
+static int compare_option(const bbx_config_option *option, const char *section, const char *key) {
+    int r = strcmp(option->section, section);
+    return r != 0 ? r : strcmp(option->key, key);
+}
+
 
 /**
  * Public functions
@@ -116,3 +135,79 @@ bool bbx_config_parse_bool(const char *value, bool *result) {
 
     return false;
 }
+
+bool bbx_config_parse_bool_option(const char *value, void *result) {
+    return bbx_config_parse_bool(value, (bool *)result);
+}
+
+bool bbx_config_parse_string_option(const char *value, void *result) {
+    char *string = strdup(value);
+    if (!string) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for config value");
+        return false;
+    }
+    *(const char **)result = string;
+    return true;
+}
+
+bool bbx_config_parse_theme_option(const char *value, void *result) {
+    bbx_themes_theme_id_t id = bbx_themes_find_theme_with_name(value);
+    if (id == BBX_THEMES_THEME_NONE) {
+        return false;
+    }
+    *(bbx_themes_theme_id_t *)result = id;
+    return true;
+}
+
+bool bbx_config_check_schema(const bbx_config_schema *schema) {
+    for (size_t i = 1; i < schema->num_options; ++i) {
+        const bbx_config_option *option = &schema->options[i];
+        if (compare_option(&schema->options[i - 1], option->section, option->key) >= 0) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "Config option \"%s\" in section \"%s\" is out of order", option->key, option->section);
+            return false;
+        }
+    }
+    return true;
+}
+
+void bbx_config_check_schemas(const bbx_config_schema *schema, ...) {
+#ifndef NDEBUG
+    static bool checked = false;
+    if (checked) {
+        return;
+    }
+    checked = true;
+
+    va_list args;
+    va_start(args, schema);
+    for (; schema; schema = va_arg(args, const bbx_config_schema *)) {
+        assert(bbx_config_check_schema(schema));
+    }
+    va_end(args);
+#else
+    (void)schema;
+#endif
+}
+
+const bbx_config_option *bbx_config_find_option(const bbx_config_schema *schema, const char *section, const char *key) {
+    size_t low = 0;
+    size_t high = schema->num_options;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        int r = compare_option(&schema->options[mid], section, key);
+        if (r == 0) {
+            return &schema->options[mid];
+        }
+        if (r < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return NULL;
+}
+
+bool bbx_config_apply_option(const bbx_config_schema *schema, void *opts, const char *section, const char *key, const char *value) {
+    const bbx_config_option *option = bbx_config_find_option(schema, section, key);
+    return option && option->parse(value, (char *)opts + option->offset);
+}
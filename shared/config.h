@@ -8,6 +8,43 @@
 #define BBX_CONFIG_H
 
 #include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * Parser for a single option value.
+ *
+ * @param value string to parse
+ * @param result pointer to the option to write the parsed value into if parsing is successful
+ * @return true on success, false otherwise
+ */
+typedef bool (*bbx_config_parser)(const char *value, void *result);
+
+/**
+ * Declaration of a single option
+ */
+typedef struct {
+    /* Section name */
+    const char *section;
+    /* Option key */
+    const char *key;
+    /* Parser for values of the option */
+    bbx_config_parser parse;
+    /* Offset of the option in the options struct */
+    size_t offset;
+} bbx_config_option;
+
+/**
+ * Declare an option stored in member of the options struct type.
+ */
+#define BBX_CONFIG_OPTION(section, key, parse, type, member) { section, key, parse, offsetof(type, member) }
+
+/**
+ * Options of an application, sorted by section and then by key (in strcmp order)
+ */
+typedef struct {
+    const bbx_config_option *options;
+    size_t num_options;
+} bbx_config_schema;
 
 /**
  * Compares two strings from opaque types.
@@ -36,4 +73,69 @@ void bbx_config_find_files(const char *path, char ***found, int *num_found);
  */
 bool bbx_config_parse_bool(const char *value, bool *result);
 
+/**
+ * Parse a boolean option value.
+ *
+ * @param value string to parse
+ * @param result pointer to a bool to write the result into if parsing is successful
+ * @return true on success, false otherwise
+ */
+bool bbx_config_parse_bool_option(const char *value, void *result);
+
+/**
+ * Parse a string option value by duplicating it.
+ *
+ * @param value string to parse
+ * @param result pointer to a const char * to write the duplicated string into if parsing is successful
+ * @return true on success, false otherwise
+ */
+bool bbx_config_parse_string_option(const char *value, void *result);
+
+/**
+ * Parse a theme option value.
+ *
+ * @param value theme name
+ * @param result pointer to a bbx_themes_theme_id_t to write the theme into if parsing is successful
+ * @return true on success, false otherwise
+ */
+bool bbx_config_parse_theme_option(const char *value, void *result);
+
+/**
+ * Check that the options of a schema are sorted and unique. Logs an error for the first violation.
+ *
+ * @param schema schema to check
+ * @return true if the schema can be used for lookups, false otherwise
+ */
+bool bbx_config_check_schema(const bbx_config_schema *schema);
+
+/**
+ * Assert that the options of schemas are sorted and unique in debug builds. The schemas are only checked on the
+ * first call because option tables are constant. Does nothing if NDEBUG is defined.
+ *
+ * @param schema first schema to check, followed by further schemas and a terminating NULL
+ */
+void bbx_config_check_schemas(const bbx_config_schema *schema, ...);
+
+/**
+ * Find an option in a schema with a binary search.
+ *
+ * @param schema schema to search
+ * @param section section name
+ * @param key option key
+ * @return the option or NULL if the schema doesn't declare it
+ */
+const bbx_config_option *bbx_config_find_option(const bbx_config_schema *schema, const char *section, const char *key);
+
+/**
+ * Parse an option value into an options struct according to a schema.
+ *
+ * @param schema schema declaring the options
+ * @param opts pointer to the options struct
+ * @param section section name
+ * @param key option key
+ * @param value option value
+ * @return true if the option was found and its value was parsed, false otherwise
+ */
+bool bbx_config_apply_option(const bbx_config_schema *schema, void *opts, const char *section, const char *key, const char *value);
+
 #endif /* BBX_CONFIG_H */
@@ -0,0 +1,508 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "config_snapshot.h"
+
+#include "config.h"
+#include "log.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define SNAPSHOT_MAGIC "BBXCONF"
+#define SNAPSHOT_VERSION 3
+
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+/**
+ * On-disk layout: the header, num_sources source records and a block of NUL-terminated strings. The string
+ * block starts with num_entries section / key / value triples, followed by the source paths.
+ */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_sources;
+    uint32_t num_entries;
+    uint32_t strings_length;
+} snapshot_header;
+
+typedef enum {
+    SOURCE_MISSING = 0,
+    SOURCE_FILE = 1,
+    SOURCE_DIRECTORY = 2
+} snapshot_source_kind;
+
+typedef struct {
+    uint64_t hash;
+    uint64_t inode;
+    int64_t size;
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+    uint32_t path_offset;
+    uint32_t kind;
+} snapshot_source;
+
+/**
+ * Static prototypes
+ */
+
+/**
+ * Append a NUL-terminated string to the entries of a snapshot.
+ *
+ * @param snapshot pointer to the snapshot
+ * @param string string to append
+ * @return true on success, false otherwise
+ */
+static bool append_string(bbx_config_snapshot *snapshot, const char *string);
+
+/**
+ * Feed a block of data into a 64-bit FNV-1a hash.
+ *
+ * @param hash current hash value
+ * @param data data to hash
+ * @param len number of bytes to hash
+ * @return updated hash value
+ */
+static uint64_t hash_data(uint64_t hash, const void *data, size_t len);
+
+/**
+ * Hash the contents of a file.
+ *
+ * @param path path of the file
+ * @param hash pointer to write the hash into
+ * @return true on success, false if the file could not be read
+ */
+static bool hash_file(const char *path, uint64_t *hash);
+
+/**
+ * Hash the sorted list of configuration files in a directory.
+ *
+ * @param path path of the directory
+ * @return hash of the list
+ */
+static uint64_t hash_directory(const char *path);
+
+/**
+ * Look up the kind and stat signature of a path.
+ *
+ * @param path path to look up
+ * @param source pointer to write the state of the path into (the path and hash members are left untouched)
+ */
+static void stat_source(const char *path, bbx_config_snapshot_source *source);
+
+/**
+ * Hash the contents of a file or the listing of a directory that stat_source() found.
+ *
+ * @param path path to hash
+ * @param source pointer to write the hash into, a file that can't be read is marked as missing
+ */
+static void hash_source(const char *path, bbx_config_snapshot_source *source);
+
+/**
+ * Get the on-disk kind of a source.
+ *
+ * @param source source to classify
+ * @return kind of the source
+ */
+static uint32_t source_kind(const bbx_config_snapshot_source *source);
+
+/**
+ * Write a buffer to a file descriptor in full.
+ *
+ * @param fd file descriptor
+ * @param buf data to write
+ * @param len number of bytes to write
+ * @return true on success, false otherwise
+ */
+static bool write_all(int fd, const void *buf, size_t len);
+
+/**
+ * Find the end of a NUL-terminated string inside a bounded block.
+ *
+ * @param block string block
+ * @param length length of the block
+ * @param offset offset of the string
+ * @return offset just past the string's NUL terminator or 0 if the string is not terminated within the block
+ */
+static size_t string_end(const char *block, size_t length, size_t offset);
+
+
+/**
+ * Static functions
+ */
+
+static bool append_string(bbx_config_snapshot *snapshot, const char *string) {
+    size_t length = strlen(string) + 1;
+    char *tmp = realloc(snapshot->entries, snapshot->entries_length + length);
+    if (!tmp) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for config snapshot entry");
+        return false;
+    }
+    snapshot->entries = tmp;
+    memcpy(snapshot->entries + snapshot->entries_length, string, length);
+    snapshot->entries_length += length;
+    return true;
+}
+
+static uint64_t hash_data(uint64_t hash, const void *data, size_t len) {
+    const unsigned char *p = data;
+    for (size_t i = 0; i < len; ++i) {
+        hash ^= p[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+static bool hash_file(const char *path, uint64_t *hash) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    uint64_t h = FNV_OFFSET_BASIS;
+    char buf[4096];
+    for (;;) {
+        ssize_t r = read(fd, buf, sizeof(buf));
+        if (r < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            close(fd);
+            return false;
+        }
+        if (r == 0) {
+            break;
+        }
+        h = hash_data(h, buf, r);
+    }
+
+    close(fd);
+    *hash = h;
+    return true;
+}
+
+static uint64_t hash_directory(const char *path) {
+    /* List the directory the same way it is parsed so that only relevant changes invalidate snapshots */
+    char **found = NULL;
+    int num_found = 0;
+    bbx_config_find_files(path, &found, &num_found);
+    qsort(found, num_found, sizeof(char *), bbx_config_compare_strings);
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (int i = 0; i < num_found; ++i) {
+        hash = hash_data(hash, found[i], strlen(found[i]) + 1);
+        free(found[i]);
+    }
+    free(found);
+    return hash;
+}
+
+static void stat_source(const char *path, bbx_config_snapshot_source *source) {
+    source->exists = false;
+    source->directory = false;
+    source->inode = 0;
+    source->size = 0;
+    source->mtime.tv_sec = 0;
+    source->mtime.tv_nsec = 0;
+
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return;
+    }
+
+    source->exists = true;
+    source->directory = S_ISDIR(st.st_mode);
+    source->inode = st.st_ino;
+    source->size = st.st_size;
+    source->mtime = st.st_mtim;
+}
+
+static void hash_source(const char *path, bbx_config_snapshot_source *source) {
+    source->hash = 0;
+    if (!source->exists) {
+        return;
+    }
+
+    if (source->directory) {
+        source->hash = hash_directory(path);
+    } else {
+        source->exists = hash_file(path, &source->hash);
+    }
+}
+
+static uint32_t source_kind(const bbx_config_snapshot_source *source) {
+    return !source->exists ? SOURCE_MISSING : source->directory ? SOURCE_DIRECTORY : SOURCE_FILE;
+}
+
+static bool write_all(int fd, const void *buf, size_t len) {
+    const char *p = buf;
+    while (len > 0) {
+        ssize_t r = write(fd, p, len);
+        if (r < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        p += r;
+        len -= r;
+    }
+    return true;
+}
+
+static size_t string_end(const char *block, size_t length, size_t offset) {
+    if (offset >= length) {
+        return 0;
+    }
+    const char *end = memchr(block + offset, '\0', length - offset);
+    return end ? (size_t)(end - block) + 1 : 0;
+}
+
+
+/**
+ * Public functions
+ */
+
+void bbx_config_snapshot_init(bbx_config_snapshot *snapshot) {
+    snapshot->sources = NULL;
+    snapshot->num_sources = 0;
+    snapshot->entries = NULL;
+    snapshot->entries_length = 0;
+    snapshot->num_entries = 0;
+    snapshot->ok = true;
+}
+
+void bbx_config_snapshot_add_source(bbx_config_snapshot *snapshot, const char *path) {
+    bbx_config_snapshot_source *tmp = realloc(snapshot->sources, (snapshot->num_sources + 1) * sizeof(bbx_config_snapshot_source));
+    char *source_path = strdup(path);
+    if (!tmp || !source_path) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for config snapshot source");
+        if (tmp) {
+            snapshot->sources = tmp;
+        }
+        free(source_path);
+        snapshot->ok = false;
+        return;
+    }
+
+    snapshot->sources = tmp;
+    bbx_config_snapshot_source *source = &snapshot->sources[snapshot->num_sources];
+    source->path = source_path;
+    stat_source(path, source);
+    hash_source(path, source);
+    snapshot->num_sources++;
+}
+
+void bbx_config_snapshot_add_entry(bbx_config_snapshot *snapshot, const char *section, const char *key, const char *value) {
+    if (!append_string(snapshot, section) || !append_string(snapshot, key) || !append_string(snapshot, value)) {
+        snapshot->ok = false;
+        return;
+    }
+    snapshot->num_entries++;
+}
+
+bool bbx_config_snapshot_write(const bbx_config_snapshot *snapshot, const char *path) {
+    if (!snapshot->ok) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Not writing incomplete config snapshot %s", path);
+        return false;
+    }
+
+    size_t strings_length = snapshot->entries_length;
+    for (int i = 0; i < snapshot->num_sources; ++i) {
+        strings_length += strlen(snapshot->sources[i].path) + 1;
+    }
+
+    snapshot_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.version = SNAPSHOT_VERSION;
+    header.num_sources = snapshot->num_sources;
+    header.num_entries = snapshot->num_entries;
+    header.strings_length = strings_length;
+
+    /* Assemble the whole snapshot so that it can be loaded with a single read */
+    size_t sources_length = snapshot->num_sources * sizeof(snapshot_source);
+    size_t length = sizeof(header) + sources_length + strings_length;
+    char *data = calloc(1, length);
+    if (!data) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for config snapshot");
+        return false;
+    }
+
+    memcpy(data, &header, sizeof(header));
+    snapshot_source *sources = (snapshot_source *)(data + sizeof(header));
+    char *strings = data + sizeof(header) + sources_length;
+
+    memcpy(strings, snapshot->entries, snapshot->entries_length);
+    size_t offset = snapshot->entries_length;
+    for (int i = 0; i < snapshot->num_sources; ++i) {
+        const bbx_config_snapshot_source *source = &snapshot->sources[i];
+        sources[i].hash = source->hash;
+        sources[i].inode = source->inode;
+        sources[i].size = source->size;
+        sources[i].mtime_sec = source->mtime.tv_sec;
+        sources[i].mtime_nsec = source->mtime.tv_nsec;
+        sources[i].kind = source_kind(source);
+        sources[i].path_offset = offset;
+
+        size_t path_length = strlen(source->path) + 1;
+        memcpy(strings + offset, source->path, path_length);
+        offset += path_length;
+    }
+
+    /* Write to a temporary file first so that readers never see a partial snapshot */
+    size_t path_length = strlen(path);
+    char tmp_path[path_length + sizeof(".tmp")];
+    memcpy(tmp_path, path, path_length);
+    memcpy(tmp_path + path_length, ".tmp", sizeof(".tmp"));
+
+    bool ok = false;
+    int fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not create config snapshot %s: %s", tmp_path, strerror(errno));
+    } else {
+        ok = write_all(fd, data, length) && fsync(fd) == 0;
+        if (close(fd) != 0) {
+            ok = false;
+        }
+        if (ok && rename(tmp_path, path) != 0) {
+            ok = false;
+        }
+        if (!ok) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "Could not write config snapshot %s: %s", path, strerror(errno));
+            unlink(tmp_path);
+        }
+    }
+
+    free(data);
+    return ok;
+}
+
+void bbx_config_snapshot_free(bbx_config_snapshot *snapshot) {
+    for (int i = 0; i < snapshot->num_sources; ++i) {
+        free(snapshot->sources[i].path);
+    }
+    free(snapshot->sources);
+    free(snapshot->entries);
+    bbx_config_snapshot_init(snapshot);
+}
+
+bool bbx_config_snapshot_load(const char *path, bbx_config_snapshot_handler handler, void *user_data) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        bbx_log(BBX_LOG_LEVEL_VERBOSE, "Could not open config snapshot %s", path);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(snapshot_header)) {
+        bbx_log(BBX_LOG_LEVEL_WARNING, "Ignoring invalid config snapshot %s", path);
+        close(fd);
+        return false;
+    }
+
+    size_t length = st.st_size;
+    char *data = malloc(length);
+    if (!data) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for config snapshot");
+        close(fd);
+        return false;
+    }
+
+    ssize_t size = read(fd, data, length);
+    close(fd);
+
+    bool ok = false;
+    snapshot_header header;
+    if (size == (ssize_t)length) {
+        memcpy(&header, data, sizeof(header));
+        /* Every entry takes at least three bytes, which also keeps num_entries * 3 from overflowing */
+        ok = memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) == 0
+            && header.version == SNAPSHOT_VERSION
+            && length == sizeof(header) + (size_t)header.num_sources * sizeof(snapshot_source) + header.strings_length
+            && header.num_entries <= header.strings_length / 3;
+    }
+    if (!ok) {
+        bbx_log(BBX_LOG_LEVEL_WARNING, "Ignoring invalid config snapshot %s", path);
+        free(data);
+        return false;
+    }
+
+    const snapshot_source *sources = (const snapshot_source *)(data + sizeof(header));
+    const char *strings = data + sizeof(header) + header.num_sources * sizeof(snapshot_source);
+
+    /* Any change to a source invalidates the whole snapshot. Sources whose signature still matches are trusted
+     * without reading them, unless they were modified no earlier than the snapshot was written, in which case a
+     * change within the same timestamp tick could go unnoticed. */
+    for (uint32_t i = 0; ok && i < header.num_sources; ++i) {
+        if (string_end(strings, header.strings_length, sources[i].path_offset) == 0) {
+            ok = false;
+            break;
+        }
+
+        const char *source_path = strings + sources[i].path_offset;
+        bbx_config_snapshot_source current;
+        stat_source(source_path, &current);
+        uint32_t kind = source_kind(&current);
+        if (kind == SOURCE_MISSING && sources[i].kind == SOURCE_MISSING) {
+            continue;
+        }
+
+        const bool unchanged = kind == sources[i].kind
+            && current.inode == sources[i].inode
+            && current.size == sources[i].size
+            && current.mtime.tv_sec == sources[i].mtime_sec
+            && current.mtime.tv_nsec == sources[i].mtime_nsec
+            && (current.mtime.tv_sec < st.st_mtim.tv_sec
+                || (current.mtime.tv_sec == st.st_mtim.tv_sec && current.mtime.tv_nsec < st.st_mtim.tv_nsec));
+        if (unchanged) {
+            continue;
+        }
+
+        /* Content that is still the same, e.g. after a touch or an unrelated change in a directory, keeps the
+         * snapshot valid */
+        if (kind == sources[i].kind) {
+            hash_source(source_path, &current);
+            kind = source_kind(&current);
+        }
+        if (kind != sources[i].kind || current.hash != sources[i].hash) {
+            bbx_log(BBX_LOG_LEVEL_VERBOSE, "Config snapshot %s is stale because %s changed", path, source_path);
+            free(data);
+            return false;
+        }
+    }
+
+    /* Validate all entries before replaying any of them so that a corrupt snapshot has no effect */
+    size_t offset = 0;
+    for (uint32_t i = 0; ok && i < header.num_entries * 3; ++i) {
+        offset = string_end(strings, header.strings_length, offset);
+        ok = offset != 0;
+    }
+    if (!ok) {
+        bbx_log(BBX_LOG_LEVEL_WARNING, "Ignoring invalid config snapshot %s", path);
+        free(data);
+        return false;
+    }
+
+    bbx_log(BBX_LOG_LEVEL_VERBOSE, "Loading config snapshot %s", path);
+
+    offset = 0;
+    for (uint32_t i = 0; i < header.num_entries; ++i) {
+        const char *section = strings + offset;
+        const char *key = section + strlen(section) + 1;
+        const char *value = key + strlen(key) + 1;
+        offset = (value + strlen(value) + 1) - strings;
+        handler(user_data, section, key, value);
+    }
+
+    free(data);
+    return true;
+}
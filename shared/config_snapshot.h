@@ -0,0 +1,113 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef BBX_CONFIG_SNAPSHOT_H
+#define BBX_CONFIG_SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * Config snapshots
+ *
+ * A snapshot stores the merged section / key / value entries of all parsed configuration files together with
+ * the stat signatures and content hashes of the files and of the directories they were read from. Loading an
+ * up-to-date snapshot takes a single read of the snapshot plus one stat per source instead of parsing every
+ * location. A source is only rehashed, or a directory rescanned, when its signature changed. Snapshots are only
+ * valid on the machine that wrote them.
+ */
+
+/**
+ * Handler for replayed entries, compatible with INIH's ini_handler
+ */
+typedef int (*bbx_config_snapshot_handler)(void *user_data, const char *section, const char *key, const char *value);
+
+/**
+ * A file or directory that a snapshot was built from
+ */
+typedef struct {
+    /* Path of the source */
+    char *path;
+    /* Inode number, size and modification time of the source */
+    uint64_t inode;
+    int64_t size;
+    struct timespec mtime;
+    /* Hash of the file's contents or of the configuration files listed in the directory */
+    uint64_t hash;
+    /* False if the source didn't exist */
+    bool exists;
+    /* True if the source is a directory */
+    bool directory;
+} bbx_config_snapshot_source;
+
+/**
+ * A snapshot that is being recorded
+ */
+typedef struct {
+    /* Recorded sources */
+    bbx_config_snapshot_source *sources;
+    int num_sources;
+    /* Recorded entries as consecutive NUL-terminated section, key and value strings */
+    char *entries;
+    size_t entries_length;
+    int num_entries;
+    /* False if recording failed and the snapshot must not be written */
+    bool ok;
+} bbx_config_snapshot;
+
+/**
+ * Initialise an empty snapshot for recording.
+ *
+ * @param snapshot pointer to the snapshot
+ */
+void bbx_config_snapshot_init(bbx_config_snapshot *snapshot);
+
+/**
+ * Record the current contents of a file or directory that entries are read from.
+ *
+ * @param snapshot pointer to the snapshot
+ * @param path path of the file or directory (may not exist)
+ */
+void bbx_config_snapshot_add_source(bbx_config_snapshot *snapshot, const char *path);
+
+/**
+ * Record a parsed entry.
+ *
+ * @param snapshot pointer to the snapshot
+ * @param section section name
+ * @param key option key
+ * @param value option value
+ */
+void bbx_config_snapshot_add_entry(bbx_config_snapshot *snapshot, const char *section, const char *key, const char *value);
+
+/**
+ * Atomically write a recorded snapshot to a file.
+ *
+ * @param snapshot pointer to the snapshot
+ * @param path path of the snapshot file
+ * @return true on success, false otherwise
+ */
+bool bbx_config_snapshot_write(const bbx_config_snapshot *snapshot, const char *path);
+
+/**
+ * Free the memory held by a snapshot.
+ *
+ * @param snapshot pointer to the snapshot
+ */
+void bbx_config_snapshot_free(bbx_config_snapshot *snapshot);
+
+/**
+ * Load a snapshot file and replay its entries if none of its sources changed since it was written.
+ *
+ * @param path path of the snapshot file
+ * @param handler function to pass each entry to, in the order they were recorded
+ * @param user_data pointer to pass to the handler
+ * @return true if the entries were replayed, false if the snapshot is missing, invalid or stale
+ */
+bool bbx_config_snapshot_load(const char *path, bbx_config_snapshot_handler handler, void *user_data);
+
+#endif /* BBX_CONFIG_SNAPSHOT_H */
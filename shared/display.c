@@ -4,7 +4,9 @@
  */
 
 #include "display.h"
+#include "drm_display.h"
 #include "log.h"
+#include "memory_display.h"
 
 #include <stdio.h>
 #include <stdbool.h>
@@ -12,6 +14,8 @@
 
 lv_display_t *bbx_display_create(bbx_backends_backend_id_t backend_id, bbx_display_config_t *config) {
     lv_display_t *disp = NULL;
+    lv_display_rotation_t rotation = config ? config->rotation : LV_DISPLAY_ROTATION_0;
+    bool is_rotated = false;
 
     switch (backend_id) {
 #if LV_USE_LINUX_FBDEV
@@ -29,6 +33,17 @@ lv_display_t *bbx_display_create(bbx_backends_backend_id_t backend_id, bbx_displ
         }
 
         lv_linux_fbdev_set_file(disp, "/dev/fb0");
+
+        /* LVGL renders in the framebuffer's native format, which it derives from the bits per pixel */
+#if !LV_DRAW_SW_SUPPORT_RGB565
+        if (lv_display_get_color_format(disp) == LV_COLOR_FORMAT_RGB565) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "/dev/fb0 uses 16 bits per pixel but RGB565 support is disabled in this build");
+            return NULL;
+        }
+#endif /* !LV_DRAW_SW_SUPPORT_RGB565 */
+        bbx_log(BBX_LOG_LEVEL_VERBOSE, "Rendering with %d bits per pixel",
+            lv_color_format_get_bpp(lv_display_get_color_format(disp)));
+
         if (config && config->fbdev_force_refresh) {
             lv_linux_fbdev_set_force_refresh(disp, true);
         }
@@ -36,13 +51,8 @@ lv_display_t *bbx_display_create(bbx_backends_backend_id_t backend_id, bbx_displ
 #endif /* LV_USE_LINUX_FBDEV */
 
 #if LV_USE_LINUX_DRM
-    case BBX_BACKENDS_BACKEND_DRM:
+    case BBX_BACKENDS_BACKEND_DRM: {
         bbx_log(BBX_LOG_LEVEL_VERBOSE, "Using DRM backend");
-        disp = lv_linux_drm_create();
-        if (!disp) {
-            bbx_log(BBX_LOG_LEVEL_ERROR, "Failed to create DRM display");
-            return NULL;
-        }
 
         char drm_path[16];
         bool found = false;
@@ -59,15 +69,52 @@ lv_display_t *bbx_display_create(bbx_backends_backend_id_t backend_id, bbx_displ
             return NULL;
         }
 
+        /* LVGL's driver can't rotate, so only drive the plane ourselves when needed */
+        if (rotation != LV_DISPLAY_ROTATION_0) {
+            disp = bbx_drm_display_create(drm_path, rotation);
+            is_rotated = disp != NULL;
+        }
+        if (disp) {
+            break;
+        }
+
+        disp = lv_linux_drm_create();
+        if (!disp) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "Failed to create DRM display");
+            return NULL;
+        }
+
         lv_linux_drm_set_file(disp, drm_path, -1);
         break;
+    }
 #endif /* LV_USE_LINUX_DRM */
 
+    case BBX_BACKENDS_BACKEND_MEMORY: {
+        bbx_log(BBX_LOG_LEVEL_VERBOSE, "Using memory backend");
+        /* The geometry needs to be known upfront because there is no device to query it from */
+        bool has_geometry = config && config->hor_res > 0 && config->ver_res > 0;
+        disp = bbx_memory_display_create(
+            has_geometry ? config->hor_res : BBX_MEMORY_DISPLAY_DEFAULT_HOR_RES,
+            has_geometry ? config->ver_res : BBX_MEMORY_DISPLAY_DEFAULT_VER_RES,
+            config && config->memory_bpp > 0 ? config->memory_bpp : BBX_MEMORY_DISPLAY_DEFAULT_BPP,
+            config ? config->memory_file : NULL);
+        if (!disp) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "Failed to create memory display");
+            return NULL;
+        }
+        break;
+    }
+
     default:
         bbx_log(BBX_LOG_LEVEL_ERROR, "Unable to find suitable backend");
         return NULL;
     }
 
+    if (rotation != LV_DISPLAY_ROTATION_0 && !is_rotated) {
+        bbx_log(BBX_LOG_LEVEL_WARNING, "Rotation requires the DRM backend with atomic modesetting, ignoring it");
+        config->rotation = LV_DISPLAY_ROTATION_0;
+    }
+
     lv_display_set_physical_resolution(disp,
         lv_display_get_horizontal_resolution(disp),
         lv_display_get_vertical_resolution(disp));
@@ -23,6 +23,13 @@ typedef struct {
     int dpi;
     /* Framebuffer force refresh quirk */
     bool fbdev_force_refresh;
+    /* File to mirror the memory backend's screen into or NULL */
+    const char *memory_file;
+    /* Bits per pixel of the memory backend, 0 for the default */
+    int memory_bpp;
+    /* Rotation of the UI relative to the panel's native orientation (only supported by the DRM backend, reset
+       to LV_DISPLAY_ROTATION_0 if it can't be applied) */
+    lv_display_rotation_t rotation;
 } bbx_display_config_t;
 
 /**
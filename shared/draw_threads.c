@@ -0,0 +1,36 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "draw_threads.h"
+
+#include "log.h"
+
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+
+/**
+ * Public functions
+ */
+
+void bbx_draw_threads_init_lvgl(void) {
+#if LV_USE_OS == LV_OS_PTHREAD
+    /* Threads inherit the signal mask of the thread that creates them */
+    sigset_t all_signals;
+    sigset_t previous_signals;
+    sigfillset(&all_signals);
+    pthread_sigmask(SIG_BLOCK, &all_signals, &previous_signals);
+    lv_init();
+    pthread_sigmask(SIG_SETMASK, &previous_signals, NULL);
+
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    bbx_log(BBX_LOG_LEVEL_VERBOSE, "Rendering on %d draw threads with %ld online CPUs", LV_DRAW_SW_DRAW_UNIT_CNT, num_cpus);
+    if (num_cpus > 0 && LV_DRAW_SW_DRAW_UNIT_CNT > num_cpus) {
+        bbx_log(BBX_LOG_LEVEL_WARNING, "More draw threads than online CPUs, consider building with draw-threads=%ld", num_cpus);
+    }
+#else
+    lv_init();
+#endif /* LV_USE_OS == LV_OS_PTHREAD */
+}
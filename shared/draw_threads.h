@@ -0,0 +1,24 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef BBX_DRAW_THREADS_H
+#define BBX_DRAW_THREADS_H
+
+#include "lvgl/lvgl.h"
+
+/**
+ * Draw threads
+ *
+ * When built with LV_USE_OS set to LV_OS_PTHREAD, LVGL renders on LV_DRAW_SW_DRAW_UNIT_CNT threads that it starts in
+ * lv_init(). Everything else, including all LVGL API calls, input handling and flushing, stays on the main thread.
+ */
+
+/**
+ * Initialise LVGL. Any draw threads are started with all signals blocked so that signals are only ever delivered
+ * to the calling thread and can interrupt its event loop.
+ */
+void bbx_draw_threads_init_lvgl(void);
+
+#endif /* BBX_DRAW_THREADS_H */
@@ -0,0 +1,746 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "drm_display.h"
+
+#if LV_USE_LINUX_DRM
+
+#include "log.h"
+
+#include <drm_fourcc.h>
+#include <xf86drm.h>
+#include <xf86drmMode.h>
+
+#include <sys/mman.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Edge length in pixels of the square tiles in which areas are rotated in software */
+#define ROTATION_TILE_SIZE 32
+
+/* Time in milliseconds to wait for a page flip before giving up on it */
+#define PAGE_FLIP_TIMEOUT 1000
+
+/**
+ * Properties of the DRM objects that are set during commits
+ */
+typedef enum {
+    PROP_CONNECTOR_CRTC_ID,
+    PROP_CRTC_MODE_ID,
+    PROP_CRTC_ACTIVE,
+    PROP_PLANE_FB_ID,
+    PROP_PLANE_CRTC_ID,
+    PROP_PLANE_SRC_X,
+    PROP_PLANE_SRC_Y,
+    PROP_PLANE_SRC_W,
+    PROP_PLANE_SRC_H,
+    PROP_PLANE_CRTC_X,
+    PROP_PLANE_CRTC_Y,
+    PROP_PLANE_CRTC_W,
+    PROP_PLANE_CRTC_H,
+    PROP_PLANE_ROTATION,
+    PROP_COUNT
+} property;
+
+/**
+ * Object types and names of the properties
+ */
+static const struct {
+    uint32_t obj_type;
+    const char *name;
+} property_names[PROP_COUNT] = {
+    [PROP_CONNECTOR_CRTC_ID] = { DRM_MODE_OBJECT_CONNECTOR, "CRTC_ID" },
+    [PROP_CRTC_MODE_ID] = { DRM_MODE_OBJECT_CRTC, "MODE_ID" },
+    [PROP_CRTC_ACTIVE] = { DRM_MODE_OBJECT_CRTC, "ACTIVE" },
+    [PROP_PLANE_FB_ID] = { DRM_MODE_OBJECT_PLANE, "FB_ID" },
+    [PROP_PLANE_CRTC_ID] = { DRM_MODE_OBJECT_PLANE, "CRTC_ID" },
+    [PROP_PLANE_SRC_X] = { DRM_MODE_OBJECT_PLANE, "SRC_X" },
+    [PROP_PLANE_SRC_Y] = { DRM_MODE_OBJECT_PLANE, "SRC_Y" },
+    [PROP_PLANE_SRC_W] = { DRM_MODE_OBJECT_PLANE, "SRC_W" },
+    [PROP_PLANE_SRC_H] = { DRM_MODE_OBJECT_PLANE, "SRC_H" },
+    [PROP_PLANE_CRTC_X] = { DRM_MODE_OBJECT_PLANE, "CRTC_X" },
+    [PROP_PLANE_CRTC_Y] = { DRM_MODE_OBJECT_PLANE, "CRTC_Y" },
+    [PROP_PLANE_CRTC_W] = { DRM_MODE_OBJECT_PLANE, "CRTC_W" },
+    [PROP_PLANE_CRTC_H] = { DRM_MODE_OBJECT_PLANE, "CRTC_H" },
+    [PROP_PLANE_ROTATION] = { DRM_MODE_OBJECT_PLANE, "rotation" }
+};
+
+/**
+ * Dumb buffer that can be scanned out
+ */
+typedef struct {
+    uint32_t handle;
+    uint32_t fb_id;
+    uint32_t width;
+    uint32_t height;
+    uint32_t pitch;
+    size_t size;
+    uint8_t *map;
+} scanout_buffer;
+
+/**
+ * State of a DRM plane display
+ */
+typedef struct {
+    int fd;
+    /* Output */
+    uint32_t connector_id;
+    uint32_t crtc_id;
+    uint32_t plane_id;
+    drmModeModeInfo mode;
+    uint32_t mode_blob_id;
+    /* Property IDs, 0 if the object doesn't have the property */
+    uint32_t props[PROP_COUNT];
+    /* Rotations supported by the plane as a mask of DRM_MODE_ROTATE_* bits */
+    uint64_t supported_rotations;
+    /* Rotation of the UI */
+    lv_display_rotation_t rotation;
+    /* Scanout buffers, only the first one is used when rotating in software */
+    scanout_buffer buffers[2];
+    /* Render buffer in the UI's orientation when rotating in software or NULL when the plane rotates */
+    uint8_t *shadow;
+    size_t shadow_size;
+    uint32_t shadow_stride;
+    /* Whether a page flip has been committed but not completed yet */
+    bool is_flip_pending;
+} drm_display;
+
+/**
+ * Static prototypes
+ */
+
+/**
+ * Handle flushing of a rendered area.
+ *
+ * @param disp display
+ * @param area rendered area
+ * @param px_map render buffer
+ */
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
+
+/**
+ * Copy an area of the shadow buffer into the scanout buffer, rotating it tile by tile so that the rows being
+ * read and the rows being written stay in the cache.
+ *
+ * @param state display state
+ * @param area area in the UI's orientation
+ * @param clip pointer for writing the rotated area in the scanout buffer into
+ */
+static void rotate_area(drm_display *state, const lv_area_t *area, drmModeClip *clip);
+
+/**
+ * Handle the completion of a page flip.
+ *
+ * @param fd DRM device file descriptor
+ * @param sequence vertical blank counter
+ * @param tv_sec seconds part of the flip's timestamp
+ * @param tv_usec microseconds part of the flip's timestamp
+ * @param user_data display state
+ */
+static void page_flip_handler(int fd, unsigned int sequence, unsigned int tv_sec, unsigned int tv_usec,
+    void *user_data);
+
+/**
+ * Wait until the pending page flip, if any, has completed.
+ *
+ * @param state display state
+ */
+static void wait_for_page_flip(drm_display *state);
+
+/**
+ * Commit a framebuffer to the primary plane.
+ *
+ * @param state display state
+ * @param buffer buffer to scan out
+ * @param rotation value of the plane's rotation property
+ * @param flags DRM_MODE_ATOMIC_* and DRM_MODE_PAGE_FLIP_* flags, the mode is only set with
+ *              DRM_MODE_ATOMIC_ALLOW_MODESET
+ * @return 0 on success or a negative error code
+ */
+static int commit(drm_display *state, const scanout_buffer *buffer, uint64_t rotation, uint32_t flags);
+
+/**
+ * Find a property of a DRM object by name.
+ *
+ * @param fd DRM device file descriptor
+ * @param obj_id object ID
+ * @param obj_type DRM_MODE_OBJECT_* type of the object
+ * @param name property name
+ * @param value pointer for writing the property's current value into or NULL
+ * @param info pointer for writing the property's metadata into (free with drmModeFreeProperty) or NULL
+ * @return the property ID or 0 if the object doesn't have the property
+ */
+static uint32_t find_property(int fd, uint32_t obj_id, uint32_t obj_type, const char *name, uint64_t *value,
+    drmModePropertyRes **info);
+
+/**
+ * Find a connected connector, its preferred mode and a CRTC to drive it with.
+ *
+ * @param state display state
+ * @param crtc_index pointer for writing the CRTC's index in the device's resources into
+ * @return true on success, false otherwise
+ */
+static bool find_output(drm_display *state, int *crtc_index);
+
+/**
+ * Find the primary plane of a CRTC.
+ *
+ * @param state display state
+ * @param crtc_index index of the CRTC in the device's resources
+ * @return true on success, false otherwise
+ */
+static bool find_primary_plane(drm_display *state, int crtc_index);
+
+/**
+ * Look up the IDs of the properties that are set during commits.
+ *
+ * @param state display state
+ * @return true if all properties except for the plane's rotation exist, false otherwise
+ */
+static bool find_properties(drm_display *state);
+
+/**
+ * Create a dumb buffer in XRGB8888 and map it.
+ *
+ * @param fd DRM device file descriptor
+ * @param width width in pixels
+ * @param height height in pixels
+ * @param buffer pointer for writing the buffer into
+ * @return true on success, false otherwise
+ */
+static bool create_buffer(int fd, uint32_t width, uint32_t height, scanout_buffer *buffer);
+
+/**
+ * Unmap and destroy a dumb buffer if it was created.
+ *
+ * @param fd DRM device file descriptor
+ * @param buffer buffer
+ */
+static void destroy_buffer(int fd, scanout_buffer *buffer);
+
+/**
+ * Get the value of the rotation property for an LVGL rotation.
+ *
+ * @param rotation LVGL rotation
+ * @return DRM_MODE_ROTATE_* bit
+ */
+static uint64_t to_drm_rotation(lv_display_rotation_t rotation);
+
+/**
+ * Static functions
+ */
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    drm_display *state = lv_display_get_driver_data(disp);
+
+    if (state->shadow) {
+        drmModeClip clip;
+        rotate_area(state, area, &clip);
+        /* Only needed by drivers that don't scan out from the buffer directly, so ignore failures */
+        drmModeDirtyFB(state->fd, state->buffers[0].fb_id, &clip, 1);
+        lv_display_flush_ready(disp);
+        return;
+    }
+
+    /* In direct mode, px_map is the whole screen and only needs to be presented once all areas are rendered */
+    if (lv_display_flush_is_last(disp)) {
+        const scanout_buffer *buffer = px_map == state->buffers[0].map ? &state->buffers[0] : &state->buffers[1];
+        int ret = commit(state, buffer, to_drm_rotation(state->rotation),
+            DRM_MODE_ATOMIC_NONBLOCK | DRM_MODE_PAGE_FLIP_EVENT);
+        if (ret < 0) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "Could not flip to rendered buffer: %s", strerror(-ret));
+        } else {
+            /* LVGL renders into the other buffer next, so it mustn't be scanned out anymore */
+            state->is_flip_pending = true;
+            wait_for_page_flip(state);
+        }
+    }
+
+    lv_display_flush_ready(disp);
+}
+
+static void rotate_area(drm_display *state, const lv_area_t *area, drmModeClip *clip) {
+    const int32_t hor_res = state->buffers[0].height;
+    const int32_t ver_res = state->buffers[0].width;
+    const uint32_t src_stride = state->shadow_stride;
+    const uint32_t dst_pitch = state->buffers[0].pitch;
+    uint8_t *dst_map = state->buffers[0].map;
+
+    if (state->rotation == LV_DISPLAY_ROTATION_180) {
+        /* Rows stay rows, so they can be copied back to front without tiling */
+        const int32_t width = state->buffers[0].width;
+        const int32_t height = state->buffers[0].height;
+        for (int32_t y = area->y1; y <= area->y2; ++y) {
+            const uint32_t *src = (const uint32_t *)(state->shadow + y * src_stride) + area->x1;
+            uint32_t *dst = (uint32_t *)(dst_map + (height - 1 - y) * dst_pitch) + (width - 1 - area->x1);
+            for (int32_t x = area->x1; x <= area->x2; ++x) {
+                *dst-- = *src++;
+            }
+        }
+        clip->x1 = width - 1 - area->x2;
+        clip->y1 = height - 1 - area->y2;
+        clip->x2 = width - area->x1;
+        clip->y2 = height - area->y1;
+        return;
+    }
+
+    /* Each column of the UI becomes a row of the scanout buffer: going right to left for 90 degrees and top to
+     * bottom for 270 degrees, the UI's rows are written left to right and right to left respectively */
+    const bool is_90 = state->rotation == LV_DISPLAY_ROTATION_90;
+    for (int32_t tile_y = area->y1; tile_y <= area->y2; tile_y += ROTATION_TILE_SIZE) {
+        const int32_t tile_y2 = LV_MIN(tile_y + ROTATION_TILE_SIZE - 1, area->y2);
+        for (int32_t tile_x = area->x1; tile_x <= area->x2; tile_x += ROTATION_TILE_SIZE) {
+            const int32_t tile_x2 = LV_MIN(tile_x + ROTATION_TILE_SIZE - 1, area->x2);
+            for (int32_t x = tile_x; x <= tile_x2; ++x) {
+                const uint8_t *src = state->shadow + tile_y * src_stride + x * sizeof(uint32_t);
+                uint32_t *dst;
+                if (is_90) {
+                    dst = (uint32_t *)(dst_map + (hor_res - 1 - x) * dst_pitch) + tile_y;
+                    for (int32_t y = tile_y; y <= tile_y2; ++y, src += src_stride) {
+                        *dst++ = *(const uint32_t *)src;
+                    }
+                } else {
+                    dst = (uint32_t *)(dst_map + x * dst_pitch) + (ver_res - 1 - tile_y);
+                    for (int32_t y = tile_y; y <= tile_y2; ++y, src += src_stride) {
+                        *dst-- = *(const uint32_t *)src;
+                    }
+                }
+            }
+        }
+    }
+
+    if (is_90) {
+        clip->x1 = area->y1;
+        clip->y1 = hor_res - 1 - area->x2;
+        clip->x2 = area->y2 + 1;
+        clip->y2 = hor_res - area->x1;
+    } else {
+        clip->x1 = ver_res - 1 - area->y2;
+        clip->y1 = area->x1;
+        clip->x2 = ver_res - area->y1;
+        clip->y2 = area->x2 + 1;
+    }
+}
+
+static void page_flip_handler(int fd, unsigned int sequence, unsigned int tv_sec, unsigned int tv_usec,
+        void *user_data) {
+    LV_UNUSED(fd);
+    LV_UNUSED(sequence);
+    LV_UNUSED(tv_sec);
+    LV_UNUSED(tv_usec);
+
+    drm_display *state = user_data;
+    state->is_flip_pending = false;
+}
+
+static void wait_for_page_flip(drm_display *state) {
+    drmEventContext context = {
+        .version = 2,
+        .page_flip_handler = page_flip_handler
+    };
+
+    while (state->is_flip_pending) {
+        struct pollfd pfd = { .fd = state->fd, .events = POLLIN };
+        int ret = poll(&pfd, 1, PAGE_FLIP_TIMEOUT);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            bbx_log(BBX_LOG_LEVEL_WARNING, "Timed out waiting for page flip");
+            state->is_flip_pending = false;
+            break;
+        }
+        drmHandleEvent(state->fd, &context);
+    }
+}
+
+static int commit(drm_display *state, const scanout_buffer *buffer, uint64_t rotation, uint32_t flags) {
+    drmModeAtomicReq *req = drmModeAtomicAlloc();
+    if (!req) {
+        return -ENOMEM;
+    }
+
+    if (flags & DRM_MODE_ATOMIC_ALLOW_MODESET) {
+        drmModeAtomicAddProperty(req, state->connector_id, state->props[PROP_CONNECTOR_CRTC_ID], state->crtc_id);
+        drmModeAtomicAddProperty(req, state->crtc_id, state->props[PROP_CRTC_MODE_ID], state->mode_blob_id);
+        drmModeAtomicAddProperty(req, state->crtc_id, state->props[PROP_CRTC_ACTIVE], 1);
+    }
+
+    /* The source rectangle is in framebuffer coordinates and the display controller rotates it into the CRTC */
+    drmModeAtomicAddProperty(req, state->plane_id, state->props[PROP_PLANE_FB_ID], buffer->fb_id);
+    drmModeAtomicAddProperty(req, state->plane_id, state->props[PROP_PLANE_CRTC_ID], state->crtc_id);
+    drmModeAtomicAddProperty(req, state->plane_id, state->props[PROP_PLANE_SRC_X], 0);
+    drmModeAtomicAddProperty(req, state->plane_id, state->props[PROP_PLANE_SRC_Y], 0);
+    drmModeAtomicAddProperty(req, state->plane_id, state->props[PROP_PLANE_SRC_W], (uint64_t)buffer->width << 16);
+    drmModeAtomicAddProperty(req, state->plane_id, state->props[PROP_PLANE_SRC_H], (uint64_t)buffer->height << 16);
+    drmModeAtomicAddProperty(req, state->plane_id, state->props[PROP_PLANE_CRTC_X], 0);
+    drmModeAtomicAddProperty(req, state->plane_id, state->props[PROP_PLANE_CRTC_Y], 0);
+    drmModeAtomicAddProperty(req, state->plane_id, state->props[PROP_PLANE_CRTC_W], state->mode.hdisplay);
+    drmModeAtomicAddProperty(req, state->plane_id, state->props[PROP_PLANE_CRTC_H], state->mode.vdisplay);
+    if (state->props[PROP_PLANE_ROTATION]) {
+        drmModeAtomicAddProperty(req, state->plane_id, state->props[PROP_PLANE_ROTATION], rotation);
+    }
+
+    int ret = drmModeAtomicCommit(state->fd, req, flags, state);
+    drmModeAtomicFree(req);
+    return ret < 0 ? -errno : 0;
+}
+
+static uint32_t find_property(int fd, uint32_t obj_id, uint32_t obj_type, const char *name, uint64_t *value,
+        drmModePropertyRes **info) {
+    drmModeObjectProperties *props = drmModeObjectGetProperties(fd, obj_id, obj_type);
+    if (!props) {
+        return 0;
+    }
+
+    uint32_t prop_id = 0;
+    for (uint32_t i = 0; i < props->count_props && prop_id == 0; ++i) {
+        drmModePropertyRes *prop = drmModeGetProperty(fd, props->props[i]);
+        if (!prop) {
+            continue;
+        }
+        if (strcmp(prop->name, name) == 0) {
+            prop_id = prop->prop_id;
+            if (value) {
+                *value = props->prop_values[i];
+            }
+            if (info) {
+                *info = prop;
+                prop = NULL;
+            }
+        }
+        drmModeFreeProperty(prop);
+    }
+
+    drmModeFreeObjectProperties(props);
+    return prop_id;
+}
+
+static bool find_output(drm_display *state, int *crtc_index) {
+    drmModeRes *res = drmModeGetResources(state->fd);
+    if (!res) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not get DRM resources: %s", strerror(errno));
+        return false;
+    }
+
+    drmModeConnector *conn = NULL;
+    for (int i = 0; i < res->count_connectors && !conn; ++i) {
+        conn = drmModeGetConnector(state->fd, res->connectors[i]);
+        if (conn && (conn->connection != DRM_MODE_CONNECTED || conn->count_modes == 0)) {
+            drmModeFreeConnector(conn);
+            conn = NULL;
+        }
+    }
+    if (!conn) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not find a connected DRM connector");
+        drmModeFreeResources(res);
+        return false;
+    }
+
+    state->connector_id = conn->connector_id;
+    state->mode = conn->modes[0];
+    for (int i = 0; i < conn->count_modes; ++i) {
+        if (conn->modes[i].type & DRM_MODE_TYPE_PREFERRED) {
+            state->mode = conn->modes[i];
+            break;
+        }
+    }
+
+    /* Prefer the CRTC that currently drives the connector, otherwise take the first one that can */
+    uint32_t possible_crtcs = 0;
+    for (int i = 0; i < conn->count_encoders; ++i) {
+        drmModeEncoder *enc = drmModeGetEncoder(state->fd, conn->encoders[i]);
+        if (!enc) {
+            continue;
+        }
+        if (enc->encoder_id == conn->encoder_id && enc->crtc_id) {
+            state->crtc_id = enc->crtc_id;
+        }
+        possible_crtcs |= enc->possible_crtcs;
+        drmModeFreeEncoder(enc);
+    }
+
+    *crtc_index = -1;
+    for (int i = 0; i < res->count_crtcs; ++i) {
+        if (state->crtc_id ? res->crtcs[i] == state->crtc_id : (possible_crtcs & (1 << i)) != 0) {
+            state->crtc_id = res->crtcs[i];
+            *crtc_index = i;
+            break;
+        }
+    }
+
+    drmModeFreeConnector(conn);
+    drmModeFreeResources(res);
+
+    if (*crtc_index < 0) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not find a CRTC for the DRM connector");
+        return false;
+    }
+    return true;
+}
+
+static bool find_primary_plane(drm_display *state, int crtc_index) {
+    drmModePlaneRes *res = drmModeGetPlaneResources(state->fd);
+    if (!res) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not get DRM plane resources: %s", strerror(errno));
+        return false;
+    }
+
+    for (uint32_t i = 0; i < res->count_planes && !state->plane_id; ++i) {
+        drmModePlane *plane = drmModeGetPlane(state->fd, res->planes[i]);
+        if (!plane) {
+            continue;
+        }
+        uint64_t type;
+        if ((plane->possible_crtcs & (1 << crtc_index))
+                && find_property(state->fd, plane->plane_id, DRM_MODE_OBJECT_PLANE, "type", &type, NULL)
+                && type == DRM_PLANE_TYPE_PRIMARY) {
+            state->plane_id = plane->plane_id;
+        }
+        drmModeFreePlane(plane);
+    }
+
+    drmModeFreePlaneResources(res);
+
+    if (!state->plane_id) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not find a primary plane for the DRM CRTC");
+        return false;
+    }
+    return true;
+}
+
+static bool find_properties(drm_display *state) {
+    for (int i = 0; i < PROP_COUNT; ++i) {
+        uint32_t obj_id;
+        switch (property_names[i].obj_type) {
+        case DRM_MODE_OBJECT_CONNECTOR:
+            obj_id = state->connector_id;
+            break;
+        case DRM_MODE_OBJECT_CRTC:
+            obj_id = state->crtc_id;
+            break;
+        default:
+            obj_id = state->plane_id;
+            break;
+        }
+
+        drmModePropertyRes *info = NULL;
+        state->props[i] = find_property(state->fd, obj_id, property_names[i].obj_type, property_names[i].name,
+            NULL, i == PROP_PLANE_ROTATION ? &info : NULL);
+
+        if (i == PROP_PLANE_ROTATION) {
+            /* Without the property, the plane can only present unrotated */
+            state->supported_rotations = DRM_MODE_ROTATE_0;
+            for (int j = 0; info && j < info->count_enums; ++j) {
+                state->supported_rotations |= 1ULL << info->enums[j].value;
+            }
+            drmModeFreeProperty(info);
+        } else if (!state->props[i]) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "DRM object %u is missing the %s property", obj_id, property_names[i].name);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool create_buffer(int fd, uint32_t width, uint32_t height, scanout_buffer *buffer) {
+    struct drm_mode_create_dumb create = { .width = width, .height = height, .bpp = 32 };
+    if (drmIoctl(fd, DRM_IOCTL_MODE_CREATE_DUMB, &create) < 0) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not create %ux%u dumb buffer: %s", width, height, strerror(errno));
+        return false;
+    }
+    buffer->handle = create.handle;
+    buffer->width = width;
+    buffer->height = height;
+    buffer->pitch = create.pitch;
+    buffer->size = create.size;
+
+    uint32_t handles[4] = { buffer->handle };
+    uint32_t pitches[4] = { buffer->pitch };
+    uint32_t offsets[4] = { 0 };
+    if (drmModeAddFB2(fd, width, height, DRM_FORMAT_XRGB8888, handles, pitches, offsets, &buffer->fb_id, 0) < 0) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not add DRM framebuffer: %s", strerror(errno));
+        goto error;
+    }
+
+    struct drm_mode_map_dumb map = { .handle = buffer->handle };
+    if (drmIoctl(fd, DRM_IOCTL_MODE_MAP_DUMB, &map) < 0) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not prepare dumb buffer for mapping: %s", strerror(errno));
+        goto error;
+    }
+
+    buffer->map = mmap(NULL, buffer->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, map.offset);
+    if (buffer->map == MAP_FAILED) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not map dumb buffer: %s", strerror(errno));
+        buffer->map = NULL;
+        goto error;
+    }
+
+    memset(buffer->map, 0, buffer->size);
+    return true;
+
+error:
+    destroy_buffer(fd, buffer);
+    return false;
+}
+
+static void destroy_buffer(int fd, scanout_buffer *buffer) {
+    if (buffer->map) {
+        munmap(buffer->map, buffer->size);
+    }
+    if (buffer->fb_id) {
+        drmModeRmFB(fd, buffer->fb_id);
+    }
+    if (buffer->handle) {
+        struct drm_mode_destroy_dumb destroy = { .handle = buffer->handle };
+        drmIoctl(fd, DRM_IOCTL_MODE_DESTROY_DUMB, &destroy);
+    }
+    memset(buffer, 0, sizeof(*buffer));
+}
+
+static uint64_t to_drm_rotation(lv_display_rotation_t rotation) {
+    /* Both LVGL and DRM rotate counterclockwise */
+    switch (rotation) {
+    case LV_DISPLAY_ROTATION_90:
+        return DRM_MODE_ROTATE_90;
+    case LV_DISPLAY_ROTATION_180:
+        return DRM_MODE_ROTATE_180;
+    case LV_DISPLAY_ROTATION_270:
+        return DRM_MODE_ROTATE_270;
+    default:
+        return DRM_MODE_ROTATE_0;
+    }
+}
+
+/**
+ * Public functions
+ */
+
+lv_display_t *bbx_drm_display_create(const char *path, lv_display_rotation_t rotation) {
+    drm_display *state = calloc(1, sizeof(drm_display));
+    if (!state) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for DRM display");
+        return NULL;
+    }
+    state->rotation = rotation;
+
+    lv_display_t *disp = NULL;
+
+    state->fd = open(path, O_RDWR | O_CLOEXEC);
+    if (state->fd < 0) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not open %s: %s", path, strerror(errno));
+        goto error;
+    }
+
+    if (drmSetClientCap(state->fd, DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1) < 0
+            || drmSetClientCap(state->fd, DRM_CLIENT_CAP_ATOMIC, 1) < 0) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "%s doesn't support atomic modesetting", path);
+        goto error;
+    }
+
+    int crtc_index;
+    if (!find_output(state, &crtc_index) || !find_primary_plane(state, crtc_index) || !find_properties(state)) {
+        goto error;
+    }
+
+    if (drmModeCreatePropertyBlob(state->fd, &state->mode, sizeof(state->mode), &state->mode_blob_id) < 0) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not create DRM mode blob: %s", strerror(errno));
+        goto error;
+    }
+
+    /* In the UI's orientation */
+    const bool is_sideways = rotation == LV_DISPLAY_ROTATION_90 || rotation == LV_DISPLAY_ROTATION_270;
+    const int32_t hor_res = is_sideways ? state->mode.vdisplay : state->mode.hdisplay;
+    const int32_t ver_res = is_sideways ? state->mode.hdisplay : state->mode.vdisplay;
+
+    /* Let the display controller rotate during scanout if it can */
+    const uint64_t drm_rotation = to_drm_rotation(rotation);
+    bool is_hw_rotation = (state->supported_rotations & drm_rotation) && state->props[PROP_PLANE_ROTATION];
+    if (is_hw_rotation) {
+        is_hw_rotation = create_buffer(state->fd, hor_res, ver_res, &state->buffers[0])
+            && commit(state, &state->buffers[0], drm_rotation,
+                DRM_MODE_ATOMIC_TEST_ONLY | DRM_MODE_ATOMIC_ALLOW_MODESET) == 0
+            && create_buffer(state->fd, hor_res, ver_res, &state->buffers[1]);
+        if (!is_hw_rotation) {
+            destroy_buffer(state->fd, &state->buffers[0]);
+            destroy_buffer(state->fd, &state->buffers[1]);
+        }
+    }
+
+    disp = lv_display_create(hor_res, ver_res);
+    if (!disp) {
+        goto error;
+    }
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_XRGB8888);
+    lv_display_set_driver_data(disp, state);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    int ret;
+    if (is_hw_rotation) {
+        bbx_log(BBX_LOG_LEVEL_VERBOSE, "Rotating display with the DRM plane");
+
+        /* Start out scanning out the second buffer so that LVGL renders the first frame into the other one */
+        ret = commit(state, &state->buffers[1], drm_rotation, DRM_MODE_ATOMIC_ALLOW_MODESET);
+        lv_display_set_buffers_with_stride(disp, state->buffers[0].map, state->buffers[1].map,
+            state->buffers[0].size, state->buffers[0].pitch, LV_DISPLAY_RENDER_MODE_DIRECT);
+    } else {
+        bbx_log(BBX_LOG_LEVEL_VERBOSE, "DRM plane can't rotate, rotating display in software");
+
+        if (!create_buffer(state->fd, state->mode.hdisplay, state->mode.vdisplay, &state->buffers[0])) {
+            goto error;
+        }
+
+        state->shadow_stride = lv_draw_buf_width_to_stride(hor_res, LV_COLOR_FORMAT_XRGB8888);
+        state->shadow_size = (size_t)state->shadow_stride * ver_res;
+        state->shadow = mmap(NULL, state->shadow_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (state->shadow == MAP_FAILED) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "Could not map render buffer: %s", strerror(errno));
+            state->shadow = NULL;
+            goto error;
+        }
+
+        ret = commit(state, &state->buffers[0], DRM_MODE_ROTATE_0, DRM_MODE_ATOMIC_ALLOW_MODESET);
+        lv_display_set_buffers(disp, state->shadow, NULL, state->shadow_size, LV_DISPLAY_RENDER_MODE_DIRECT);
+    }
+
+    if (ret < 0) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not set DRM mode: %s", strerror(-ret));
+        goto error;
+    }
+
+    drmModeConnector *conn = drmModeGetConnector(state->fd, state->connector_id);
+    if (conn && conn->mmWidth > 0) {
+        lv_display_set_dpi(disp, (state->mode.hdisplay * 254 + conn->mmWidth * 5) / (conn->mmWidth * 10));
+    }
+    drmModeFreeConnector(conn);
+
+    bbx_log(BBX_LOG_LEVEL_VERBOSE, "Using %ux%u DRM mode, rendering at %dx%d",
+        state->mode.hdisplay, state->mode.vdisplay, hor_res, ver_res);
+    return disp;
+
+error:
+    if (disp) {
+        lv_display_delete(disp);
+    }
+    if (state->shadow) {
+        munmap(state->shadow, state->shadow_size);
+    }
+    if (state->fd >= 0) {
+        destroy_buffer(state->fd, &state->buffers[0]);
+        destroy_buffer(state->fd, &state->buffers[1]);
+        if (state->mode_blob_id) {
+            drmModeDestroyPropertyBlob(state->fd, state->mode_blob_id);
+        }
+        close(state->fd);
+    }
+    free(state);
+    return NULL;
+}
+
+#endif /* LV_USE_LINUX_DRM */
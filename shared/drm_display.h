@@ -0,0 +1,36 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef BBX_DRM_DISPLAY_H
+#define BBX_DRM_DISPLAY_H
+
+#include "lvgl/lvgl.h"
+
+#if LV_USE_LINUX_DRM
+
+/**
+ * DRM plane display
+ *
+ * A display that drives the primary plane of a DRM device via atomic modesetting and presents the UI rotated
+ * relative to the panel's native orientation. If the plane's rotation property supports the requested rotation,
+ * LVGL renders unrotated into two scanout buffers that are flipped on vertical blank and the display controller
+ * rotates them during scanout. Otherwise, LVGL renders into a shadow buffer and each flushed area is rotated in
+ * tiles into a single scanout buffer.
+ *
+ * Rotations follow LVGL's convention, i.e. LV_DISPLAY_ROTATION_90 turns the UI by 90 degrees counterclockwise.
+ */
+
+/**
+ * Create a DRM plane display.
+ *
+ * @param path path of the DRM device
+ * @param rotation rotation of the UI relative to the panel's native orientation
+ * @return the display or NULL on failure
+ */
+lv_display_t *bbx_drm_display_create(const char *path, lv_display_rotation_t rotation);
+
+#endif /* LV_USE_LINUX_DRM */
+
+#endif /* BBX_DRM_DISPLAY_H */
@@ -15,6 +15,7 @@
 #endif
 #include <sys/epoll.h>
 #include <sys/stat.h>
+#include <sys/timerfd.h>
 #ifndef BBX_APP_BUFFYBOARD
 #include <xkbcommon/xkbcommon.h>
 #endif
@@ -25,7 +26,9 @@
 #include <libinput.h>
 #include <libudev.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 
 #ifndef BBX_APP_BUFFYBOARD
@@ -43,6 +46,13 @@ enum input_device_type {
     BBX_INDEV_OTHER
 };
 
+enum input_device_capability {
+    BBX_INDEV_CAP_KEYBOARD = 1 << 0,
+    BBX_INDEV_CAP_POINTER = 1 << 1,
+    /* Touchscreens that track more than one finger */
+    BBX_INDEV_CAP_MULTITOUCH = 1 << 2
+};
+
 struct input_device_ext {
     /* The second pointer is used to represent the second finger on touchscreens.
        This makes typing with thumbs convenient */
@@ -53,6 +63,11 @@ struct input_device_ext {
     struct xkb_state* xkb_state;
 #endif
     enum input_device_type type;
+    /* Identifies the device in input traces */
+    uint8_t trace_id;
+    /* Links all attached devices so that they can be revisited when the filters change */
+    struct libinput_device* device;
+    struct input_device_ext* next;
 };
 
 /* The analog of lv_indev_data_t, but without unused fields */
@@ -64,6 +79,48 @@ struct indev_ext {
     lv_indev_state_t state;
 };
 
+/* Input traces consist of a trace_header followed by trace_records in native byte order */
+#define TRACE_MAGIC "BBXTRC"
+#define TRACE_VERSION 1
+
+struct trace_header {
+    char magic[6];
+    uint16_t version;
+    /* Physical resolution that absolute coordinates are transformed to */
+    int32_t hor_res;
+    int32_t ver_res;
+};
+
+enum trace_record_type {
+    /* value holds the input_device_type in the low byte and the input_device_capability flags above it */
+    TRACE_DEVICE_ADDED,
+    TRACE_DEVICE_REMOVED,
+    /* value holds the evdev key code */
+    TRACE_KEY_PRESSED,
+    TRACE_KEY_RELEASED,
+    /* x and y hold the relative motion */
+    TRACE_POINTER_MOTION,
+    /* x and y hold the transformed coordinates */
+    TRACE_POINTER_MOTION_ABSOLUTE,
+    TRACE_POINTER_PRESSED,
+    TRACE_POINTER_RELEASED,
+    /* slot holds the touch slot, x and y hold the transformed coordinates */
+    TRACE_TOUCH_DOWN,
+    TRACE_TOUCH_MOTION,
+    TRACE_TOUCH_UP
+};
+
+struct trace_record {
+    /* Microseconds since the start of the recording */
+    uint64_t time;
+    uint8_t type;
+    uint8_t device;
+    int16_t slot;
+    uint32_t value;
+    int32_t x;
+    int32_t y;
+};
+
 /**
  * Static variables
  */
@@ -76,6 +133,24 @@ static struct xkb_keymap *keymap;
 #endif
 static lv_obj_t *mouse_cursor;
 static bool libinput_is_suspended = false;
+static struct input_device_ext *attached_devices = NULL;
+
+static FILE *record_file = NULL;
+static uint64_t record_start;
+static uint8_t next_trace_id = 0;
+
+static struct {
+    struct trace_record *records;
+    size_t num_records;
+    size_t next_record;
+    int fd_timer;
+    bool is_fast;
+    uint64_t start;
+    /* Replayed devices by trace id */
+    struct input_device_ext *devices[UINT8_MAX + 1];
+} replay = { .fd_timer = -1 };
+
+static void (*on_replay_finished_cb)() = NULL;
 
 #ifndef BBX_APP_BUFFYBOARD
 static uint8_t num_keyboards = 0;
@@ -95,6 +170,9 @@ static struct {
     uint8_t touchscreen : 1;
 } options;
 
+/* Rotation of the UI relative to the panel that LVGL doesn't know about */
+static lv_display_rotation_t rotation = LV_DISPLAY_ROTATION_0;
+
 /**
  * Static functions
  */
@@ -158,25 +236,65 @@ static enum input_device_type identify_input_device(struct udev_device* device)
     return ret;
 }
 
-static void add_device_extension(struct libinput_device* device) {
-    enum input_device_type type = (enum input_device_type) libinput_device_get_user_data(device);
-    libinput_device_set_user_data(device, NULL);
-    if (type == BBX_INDEV_NONE) {
-        struct udev_device *dev = libinput_device_get_udev_device(device);
-        if (!dev) {
-            bbx_log(BBX_LOG_LEVEL_ERROR, "libinput_device_get_udev_device(%s) is failed", libinput_device_get_sysname(device));
-            goto failure1;
-        }
-        type = identify_input_device(dev);
-        udev_device_unref(dev);
-        if (type == BBX_INDEV_NONE)
-            goto failure1;
+static uint64_t get_monotonic_time_us() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+static void record_event(enum trace_record_type type, const struct input_device_ext* ext,
+                         int32_t slot, uint32_t value, int32_t x, int32_t y) {
+    if (!record_file)
+        return;
+
+    struct trace_record record = {
+        .time = get_monotonic_time_us() - record_start,
+        .type = type,
+        .device = ext->trace_id,
+        .slot = slot,
+        .value = value,
+        .x = x,
+        .y = y
+    };
+    if (fwrite(&record, sizeof(record), 1, record_file) != 1) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not write input trace, stopping recording");
+        fclose(record_file);
+        record_file = NULL;
+    }
+}
+
+static lv_indev_t* create_pointer(void) {
+    lv_indev_t* pointer = lv_indev_create();
+    if (!pointer) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Out of memory");
+        return NULL;
     }
 
+    struct indev_ext* data = malloc(sizeof(struct indev_ext));
+    if (!data) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Out of memory");
+        lv_indev_delete(pointer);
+        return NULL;
+    }
+
+    lv_display_t* display = lv_indev_get_display(pointer);
+    data->point.x = display->hor_res / 2;
+    data->point.y = display->ver_res / 2;
+    data->state = LV_INDEV_STATE_RELEASED;
+
+    lv_indev_set_type(pointer, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_mode(pointer, LV_INDEV_MODE_EVENT);
+    lv_indev_set_user_data(pointer, data);
+    lv_indev_set_read_cb(pointer, read_pointer);
+    return pointer;
+}
+
+static struct input_device_ext* create_device_extension(enum input_device_type type, uint32_t capabilities,
+                                                        const char* name) {
     struct input_device_ext* ext = malloc(sizeof(struct input_device_ext));
     if (!ext) {
         bbx_log(BBX_LOG_LEVEL_ERROR, "Out of memory");
-        goto failure1;
+        return NULL;
     }
 
     ext->pointer1 = NULL;
@@ -186,9 +304,12 @@ static void add_device_extension(struct libinput_device* device) {
     ext->xkb_state = NULL;
 #endif
     ext->type = type;
+    ext->trace_id = 0;
+    ext->device = NULL;
+    ext->next = NULL;
 
 #ifndef BBX_APP_BUFFYBOARD
-    if (libinput_device_has_capability(device, LIBINPUT_DEVICE_CAP_KEYBOARD)) {
+    if (capabilities & BBX_INDEV_CAP_KEYBOARD) {
         ext->keypad = lv_indev_create();
         if (!ext->keypad) {
             bbx_log(BBX_LOG_LEVEL_ERROR, "Out of memory");
@@ -199,6 +320,7 @@ static void add_device_extension(struct libinput_device* device) {
         if (!data) {
             bbx_log(BBX_LOG_LEVEL_ERROR, "Out of memory");
             lv_indev_delete(ext->keypad);
+            ext->keypad = NULL;
             goto failure2;
         }
 
@@ -214,59 +336,20 @@ static void add_device_extension(struct libinput_device* device) {
         if (ext->type == BBX_INDEV_KEYBOARD) {
             ext->xkb_state = xkb_state_new(keymap);
             if (!ext->xkb_state)
-                bbx_log(BBX_LOG_LEVEL_WARNING, "Can't create xkb_state for %s", libinput_device_get_sysname(device));
+                bbx_log(BBX_LOG_LEVEL_WARNING, "Can't create xkb_state for %s", name);
         }
     }
 #endif
 
-    if (libinput_device_has_capability(device, LIBINPUT_DEVICE_CAP_POINTER) ||
-        libinput_device_has_capability(device, LIBINPUT_DEVICE_CAP_TOUCH)) {
-        ext->pointer1 = lv_indev_create();
-        if (!ext->pointer1) {
-            bbx_log(BBX_LOG_LEVEL_ERROR, "Out of memory");
-            goto failure3;
-        }
-
-        struct indev_ext* data1 = malloc(sizeof(struct indev_ext));
-        if (!data1) {
-            bbx_log(BBX_LOG_LEVEL_ERROR, "Out of memory");
-            lv_indev_delete(ext->pointer1);
+    if (capabilities & BBX_INDEV_CAP_POINTER) {
+        ext->pointer1 = create_pointer();
+        if (!ext->pointer1)
             goto failure3;
-        }
-
-        lv_display_t* display = lv_indev_get_display(ext->pointer1);
-        data1->point.x = display->hor_res / 2;
-        data1->point.y = display->ver_res / 2;
-        data1->state = LV_INDEV_STATE_RELEASED;
-
-        lv_indev_set_type(ext->pointer1, LV_INDEV_TYPE_POINTER);
-        lv_indev_set_mode(ext->pointer1, LV_INDEV_MODE_EVENT);
-        lv_indev_set_user_data(ext->pointer1, data1);
-        lv_indev_set_read_cb(ext->pointer1, read_pointer);
-
-        if (libinput_device_has_capability(device, LIBINPUT_DEVICE_CAP_TOUCH) &&
-            libinput_device_touch_get_touch_count(device) != 1) {
-            ext->pointer2 = lv_indev_create();
-            if (!ext->pointer2) {
-                bbx_log(BBX_LOG_LEVEL_ERROR, "Out of memory");
-                goto failure3;
-            }
 
-            struct indev_ext* data2 = malloc(sizeof(struct indev_ext));
-            if (!data2) {
-                bbx_log(BBX_LOG_LEVEL_ERROR, "Out of memory");
-                lv_indev_delete(ext->pointer2);
+        if (capabilities & BBX_INDEV_CAP_MULTITOUCH) {
+            ext->pointer2 = create_pointer();
+            if (!ext->pointer2)
                 goto failure3;
-            }
-
-            data2->point.x = display->hor_res / 2;
-            data2->point.y = display->ver_res / 2;
-            data2->state = LV_INDEV_STATE_RELEASED;
-
-            lv_indev_set_type(ext->pointer2, LV_INDEV_TYPE_POINTER);
-            lv_indev_set_mode(ext->pointer2, LV_INDEV_MODE_EVENT);
-            lv_indev_set_user_data(ext->pointer2, data2);
-            lv_indev_set_read_cb(ext->pointer2, read_pointer);
         }
 
         if (ext->type == BBX_INDEV_MOUSE || ext->type == BBX_INDEV_TOUCHPAD) {
@@ -280,13 +363,10 @@ static void add_device_extension(struct libinput_device* device) {
 #else
     if (!ext->pointer1) {
 #endif
-        bbx_log(BBX_LOG_LEVEL_VERBOSE, "%s does not have required capabilities, ignoring.",
-            libinput_device_get_sysname(device));
+        bbx_log(BBX_LOG_LEVEL_VERBOSE, "%s does not have required capabilities, ignoring.", name);
         goto failure2;
     }
 
-    libinput_device_set_user_data(device, ext);
-
 #ifndef BBX_APP_BUFFYBOARD
     if (ext->type == BBX_INDEV_KEYBOARD)
         num_keyboards++;
@@ -299,8 +379,8 @@ static void add_device_extension(struct libinput_device* device) {
     if (num_mouses != 0 || num_touchpads != 0)
         lv_obj_remove_flag(mouse_cursor, LV_OBJ_FLAG_HIDDEN);
 
-    bbx_log(BBX_LOG_LEVEL_VERBOSE, "New input device: %s", libinput_device_get_name(device));
-    return;
+    bbx_log(BBX_LOG_LEVEL_VERBOSE, "New input device: %s", name);
+    return ext;
 
 
 failure3:
@@ -323,9 +403,243 @@ failure3:
 #endif
 failure2:
     free(ext);
-failure1:
-    libinput_path_remove_device(device);
+    return NULL;
+}
+
+static void destroy_device_extension(struct input_device_ext* ext) {
+    if (ext->pointer1) {
+        free(lv_indev_get_user_data(ext->pointer1));
+        lv_indev_delete(ext->pointer1);
+    }
+    if (ext->pointer2) {
+        free(lv_indev_get_user_data(ext->pointer2));
+        lv_indev_delete(ext->pointer2);
+    }
+#ifndef BBX_APP_BUFFYBOARD
+    if (ext->keypad) {
+        free(lv_indev_get_user_data(ext->keypad));
+        lv_indev_delete(ext->keypad);
+    }
+    if (ext->xkb_state) {
+        xkb_state_unref(ext->xkb_state);
+    }
+
+    if (ext->type == BBX_INDEV_KEYBOARD) {
+        assert(num_keyboards > 0);
+        num_keyboards--;
+    } else
+#endif
+    if (ext->type == BBX_INDEV_MOUSE) {
+        assert(num_mouses > 0);
+        num_mouses--;
+    } else if (ext->type == BBX_INDEV_TOUCHPAD) {
+        assert(num_touchpads > 0);
+        num_touchpads--;
+    }
+    if (num_mouses == 0 && num_touchpads == 0)
+        lv_obj_add_flag(mouse_cursor, LV_OBJ_FLAG_HIDDEN);
+
+    free(ext);
+}
+
+static void add_device_extension(struct libinput_device* device) {
+    enum input_device_type type = (enum input_device_type) libinput_device_get_user_data(device);
+    libinput_device_set_user_data(device, NULL);
+    if (type == BBX_INDEV_NONE) {
+        struct udev_device *dev = libinput_device_get_udev_device(device);
+        if (!dev) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "libinput_device_get_udev_device(%s) is failed", libinput_device_get_sysname(device));
+            goto failure;
+        }
+        type = identify_input_device(dev);
+        udev_device_unref(dev);
+        if (type == BBX_INDEV_NONE)
+            goto failure;
+    }
+
+    uint32_t capabilities = 0;
+    if (libinput_device_has_capability(device, LIBINPUT_DEVICE_CAP_KEYBOARD))
+        capabilities |= BBX_INDEV_CAP_KEYBOARD;
+    if (libinput_device_has_capability(device, LIBINPUT_DEVICE_CAP_POINTER) ||
+        libinput_device_has_capability(device, LIBINPUT_DEVICE_CAP_TOUCH))
+        capabilities |= BBX_INDEV_CAP_POINTER;
+    if (libinput_device_has_capability(device, LIBINPUT_DEVICE_CAP_TOUCH) &&
+        libinput_device_touch_get_touch_count(device) != 1)
+        capabilities |= BBX_INDEV_CAP_MULTITOUCH;
+
+    struct input_device_ext* ext = create_device_extension(type, capabilities, libinput_device_get_name(device));
+    if (!ext)
+        goto failure;
+
+    libinput_device_set_user_data(device, ext);
+
+    ext->device = device;
+    ext->next = attached_devices;
+    attached_devices = ext;
+
+    /* Ids are reused after 256 devices were attached. Devices are hardly ever connected this often during
+       a recording. */
+    ext->trace_id = next_trace_id++;
+    record_event(TRACE_DEVICE_ADDED, ext, 0, type | capabilities << 8, 0, 0);
     return;
+
+failure:
+    libinput_path_remove_device(device);
+}
+
+static lv_indev_t* get_touch_pointer(struct input_device_ext* ext, int32_t slot) {
+    if (slot <= 0)
+        return ext->pointer1;
+    if (slot == 1)
+        return ext->pointer2;
+    return NULL;
+}
+
+#ifndef BBX_APP_BUFFYBOARD
+static void handle_key(struct input_device_ext* ext, uint32_t key, bool pressed) {
+    struct indev_ext *data = lv_indev_get_user_data(ext->keypad);
+    xkb_keycode_t keycode = key + 8;
+    bool ignore = false;
+
+    switch (key) {
+    case KEY_UP:
+        data->key = LV_KEY_UP;
+        break;
+    case KEY_DOWN:
+        data->key = LV_KEY_DOWN;
+        break;
+    case KEY_RIGHT:
+        data->key = LV_KEY_RIGHT;
+        break;
+    case KEY_LEFT:
+        data->key = LV_KEY_LEFT;
+        break;
+    case KEY_ESC:
+        data->key = LV_KEY_ESC;
+        break;
+    case KEY_DELETE:
+        data->key = LV_KEY_DEL;
+        break;
+    case KEY_BACKSPACE:
+        data->key = LV_KEY_BACKSPACE;
+        break;
+    case KEY_ENTER:
+        data->key = LV_KEY_ENTER;
+        break;
+    case KEY_NEXT:
+    case KEY_TAB:
+        data->key = LV_KEY_NEXT;
+        break;
+    case KEY_PREVIOUS:
+        data->key = LV_KEY_PREV;
+        break;
+    case KEY_HOME:
+        data->key = LV_KEY_HOME;
+        break;
+    case KEY_END:
+        data->key = LV_KEY_END;
+        break;
+    case KEY_POWER:
+        if (pressed && on_key_power_cb)
+            on_key_power_cb();
+        ignore = true;
+        break;
+    default: {
+        if (!ext->xkb_state) {
+            ignore = true;
+            break;
+        }
+        char buffer[] = { 0, 0, 0, 0, 0 };
+        int size = xkb_state_key_get_utf8(ext->xkb_state, keycode, buffer, sizeof(buffer));
+        if (size == 0) {
+            ignore = true;
+            break;
+        }
+        data->key = *((uint32_t*) buffer);
+        break;
+    }}
+
+    if (ext->xkb_state)
+        xkb_state_update_key(ext->xkb_state, keycode, pressed ? XKB_KEY_DOWN : XKB_KEY_UP);
+
+    if (ignore)
+        return;
+
+    data->state = pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+
+    lv_indev_read(ext->keypad);
+}
+#endif
+
+static void handle_pointer_motion(struct input_device_ext* ext, int32_t dx, int32_t dy) {
+    struct indev_ext *data = lv_indev_get_user_data(ext->pointer1);
+    lv_display_t* display = lv_indev_get_display(ext->pointer1);
+
+    int32_t x = data->point.x + dx;
+    data->point.x = LV_CLAMP(0, x, display->hor_res - 1);
+    int32_t y = data->point.y + dy;
+    data->point.y = LV_CLAMP(0, y, display->ver_res - 1);
+
+    lv_indev_read(ext->pointer1);
+}
+
+static void handle_pointer_button(struct input_device_ext* ext, bool pressed) {
+    struct indev_ext *data = lv_indev_get_user_data(ext->pointer1);
+    data->state = pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+
+    lv_indev_read(ext->pointer1);
+}
+
+static void get_panel_size(lv_display_t* display, uint32_t* width, uint32_t* height) {
+    /* Absolute devices report positions on the panel, which is sideways if the UI is rotated by 90 or 270 degrees */
+    bool is_sideways = rotation == LV_DISPLAY_ROTATION_90 || rotation == LV_DISPLAY_ROTATION_270;
+    *width = is_sideways ? display->physical_ver_res : display->physical_hor_res;
+    *height = is_sideways ? display->physical_hor_res : display->physical_ver_res;
+}
+
+static void rotate_position(lv_display_t* display, int32_t* x, int32_t* y) {
+    const int32_t panel_x = *x;
+    const int32_t panel_y = *y;
+
+    switch (rotation) {
+    case LV_DISPLAY_ROTATION_90:
+        *x = display->physical_hor_res - panel_y - 1;
+        *y = panel_x;
+        break;
+    case LV_DISPLAY_ROTATION_180:
+        *x = display->physical_hor_res - panel_x - 1;
+        *y = display->physical_ver_res - panel_y - 1;
+        break;
+    case LV_DISPLAY_ROTATION_270:
+        *x = panel_y;
+        *y = display->physical_ver_res - panel_x - 1;
+        break;
+    default:
+        break;
+    }
+}
+
+static void handle_position(lv_indev_t* pointer, int32_t x, int32_t y, bool is_down) {
+    struct indev_ext *data = lv_indev_get_user_data(pointer);
+    lv_display_t* display = lv_indev_get_display(pointer);
+
+    x -= display->offset_x;
+    y -= display->offset_y;
+    if (x < 0 || x >= display->hor_res || y < 0 || y >= display->ver_res)
+        return;
+    data->point.x = x;
+    data->point.y = y;
+    if (is_down)
+        data->state = LV_INDEV_STATE_PRESSED;
+
+    lv_indev_read(pointer);
+}
+
+static void handle_touch_up(lv_indev_t* pointer) {
+    struct indev_ext *data = lv_indev_get_user_data(pointer);
+    data->state = LV_INDEV_STATE_RELEASED;
+
+    lv_indev_read(pointer);
 }
 
 static void on_input_event() {
@@ -346,39 +660,16 @@ static void on_input_event() {
             if (!ext)
                 break;
 
-            if (ext->pointer1) {
-                free(lv_indev_get_user_data(ext->pointer1));
-                lv_indev_delete(ext->pointer1);
-            }
-            if (ext->pointer2) {
-                free(lv_indev_get_user_data(ext->pointer2));
-                lv_indev_delete(ext->pointer2);
-            }
-#ifndef BBX_APP_BUFFYBOARD
-            if (ext->keypad) {
-                free(lv_indev_get_user_data(ext->keypad));
-                lv_indev_delete(ext->keypad);
-            }
-            if (ext->xkb_state) {
-                xkb_state_unref(ext->xkb_state);
-            }
+            record_event(TRACE_DEVICE_REMOVED, ext, 0, 0, 0, 0);
 
-            if (ext->type == BBX_INDEV_KEYBOARD) {
-                assert(num_keyboards > 0);
-                num_keyboards--;
-            } else
-#endif
-            if (ext->type == BBX_INDEV_MOUSE) {
-                assert(num_mouses > 0);
-                num_mouses--;
-            } else if (ext->type == BBX_INDEV_TOUCHPAD) {
-                assert(num_touchpads > 0);
-                num_touchpads--;
+            for (struct input_device_ext** link = &attached_devices; *link; link = &(*link)->next) {
+                if (*link == ext) {
+                    *link = ext->next;
+                    break;
+                }
             }
-            if (num_mouses == 0 && num_touchpads == 0)
-                lv_obj_add_flag(mouse_cursor, LV_OBJ_FLAG_HIDDEN);
 
-            free(ext);
+            destroy_device_extension(ext);
             break;
         }
 
@@ -386,79 +677,11 @@ static void on_input_event() {
         case LIBINPUT_EVENT_KEYBOARD_KEY: {
             struct libinput_event_keyboard *kb_event = libinput_event_get_keyboard_event(event);
 
-            struct indev_ext *data = lv_indev_get_user_data(ext->keypad);
             uint32_t key = libinput_event_keyboard_get_key(kb_event);
             bool pressed = libinput_event_keyboard_get_key_state(kb_event) == LIBINPUT_KEY_STATE_PRESSED;
-            xkb_keycode_t keycode = key + 8;
-            bool ignore = false;
-
-            switch (key) {
-            case KEY_UP:
-                data->key = LV_KEY_UP;
-                break;
-            case KEY_DOWN:
-                data->key = LV_KEY_DOWN;
-                break;
-            case KEY_RIGHT:
-                data->key = LV_KEY_RIGHT;
-                break;
-            case KEY_LEFT:
-                data->key = LV_KEY_LEFT;
-                break;
-            case KEY_ESC:
-                data->key = LV_KEY_ESC;
-                break;
-            case KEY_DELETE:
-                data->key = LV_KEY_DEL;
-                break;
-            case KEY_BACKSPACE:
-                data->key = LV_KEY_BACKSPACE;
-                break;
-            case KEY_ENTER:
-                data->key = LV_KEY_ENTER;
-                break;
-            case KEY_NEXT:
-            case KEY_TAB:
-                data->key = LV_KEY_NEXT;
-                break;
-            case KEY_PREVIOUS:
-                data->key = LV_KEY_PREV;
-                break;
-            case KEY_HOME:
-                data->key = LV_KEY_HOME;
-                break;
-            case KEY_END:
-                data->key = LV_KEY_END;
-                break;
-            case KEY_POWER:
-                if (pressed && on_key_power_cb)
-                    on_key_power_cb();
-                ignore = true;
-                break;
-            default: {
-                if (!ext->xkb_state) {
-                    ignore = true;
-                    break;
-                }
-                char buffer[] = { 0, 0, 0, 0, 0 };
-                int size = xkb_state_key_get_utf8(ext->xkb_state, keycode, buffer, sizeof(buffer));
-                if (size == 0) {
-                    ignore = true;
-                    break;
-                }
-                data->key = *((uint32_t*) buffer);
-                break;
-            }}
-
-            if (ext->xkb_state)
-                xkb_state_update_key(ext->xkb_state, keycode, pressed ? XKB_KEY_DOWN : XKB_KEY_UP);
-
-            if (ignore)
-                break;
 
-            data->state = pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
-
-            lv_indev_read(ext->keypad);
+            record_event(pressed ? TRACE_KEY_PRESSED : TRACE_KEY_RELEASED, ext, 0, key, 0, 0);
+            handle_key(ext, key, pressed);
             break;
         }
 #endif
@@ -466,102 +689,62 @@ static void on_input_event() {
         case LIBINPUT_EVENT_POINTER_MOTION: {
             struct libinput_event_pointer *pointer_event = libinput_event_get_pointer_event(event);
 
-            struct indev_ext *data = lv_indev_get_user_data(ext->pointer1);
-            lv_display_t* display = lv_indev_get_display(ext->pointer1);
-
-            int32_t x = data->point.x + (int32_t) libinput_event_pointer_get_dx(pointer_event);
-            data->point.x = LV_CLAMP(0, x, display->hor_res - 1);
-            int32_t y = data->point.y + (int32_t) libinput_event_pointer_get_dy(pointer_event);
-            data->point.y = LV_CLAMP(0, y, display->ver_res - 1);
+            int32_t dx = (int32_t) libinput_event_pointer_get_dx(pointer_event);
+            int32_t dy = (int32_t) libinput_event_pointer_get_dy(pointer_event);
 
-            lv_indev_read(ext->pointer1);
+            record_event(TRACE_POINTER_MOTION, ext, 0, 0, dx, dy);
+            handle_pointer_motion(ext, dx, dy);
             break;
         }
 
         case LIBINPUT_EVENT_POINTER_BUTTON: {
             struct libinput_event_pointer *pointer_event = libinput_event_get_pointer_event(event);
 
-            struct indev_ext *data = lv_indev_get_user_data(ext->pointer1);
-            data->state = libinput_event_pointer_get_button_state(pointer_event) == LIBINPUT_BUTTON_STATE_PRESSED ?
-                LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+            bool pressed = libinput_event_pointer_get_button_state(pointer_event) == LIBINPUT_BUTTON_STATE_PRESSED;
 
-            lv_indev_read(ext->pointer1);
+            record_event(pressed ? TRACE_POINTER_PRESSED : TRACE_POINTER_RELEASED, ext, 0, 0, 0, 0);
+            handle_pointer_button(ext, pressed);
             break;
         }
 
         case LIBINPUT_EVENT_POINTER_MOTION_ABSOLUTE: {
             struct libinput_event_pointer *pointer_event = libinput_event_get_pointer_event(event);
 
-            struct indev_ext *data = lv_indev_get_user_data(ext->pointer1);
             lv_display_t* display = lv_indev_get_display(ext->pointer1);
 
-            int32_t x = libinput_event_pointer_get_absolute_x_transformed(pointer_event, display->physical_hor_res);
-            int32_t y = libinput_event_pointer_get_absolute_y_transformed(pointer_event, display->physical_ver_res);
-            x -= display->offset_x;
-            y -= display->offset_y;
-            if (x < 0 || x >= display->hor_res || y < 0 || y >= display->ver_res)
-                break;
-            data->point.x = x;
-            data->point.y = y;
-
-            lv_indev_read(ext->pointer1);
-            break;
-        }
-
-        case LIBINPUT_EVENT_TOUCH_MOTION: {
-            struct libinput_event_touch *touch_event = libinput_event_get_touch_event(event);
-            int32_t slot = libinput_event_touch_get_slot(touch_event);
-
-            lv_indev_t *pointer;
-            if (slot <= 0)
-                pointer = ext->pointer1;
-            else if (slot == 1)
-                pointer = ext->pointer2;
-            else
-                break;
+            uint32_t width, height;
+            get_panel_size(display, &width, &height);
 
-            struct indev_ext *data = lv_indev_get_user_data(pointer);
-            lv_display_t* display = lv_indev_get_display(pointer);
+            int32_t x = libinput_event_pointer_get_absolute_x_transformed(pointer_event, width);
+            int32_t y = libinput_event_pointer_get_absolute_y_transformed(pointer_event, height);
+            rotate_position(display, &x, &y);
 
-            int32_t x = libinput_event_touch_get_x_transformed(touch_event, display->physical_hor_res);
-            int32_t y = libinput_event_touch_get_y_transformed(touch_event, display->physical_ver_res);
-            x -= display->offset_x;
-            y -= display->offset_y;
-            if (x < 0 || x >= display->hor_res || y < 0 || y >= display->ver_res)
-                break;
-            data->point.x = x;
-            data->point.y = y;
-
-            lv_indev_read(pointer);
+            record_event(TRACE_POINTER_MOTION_ABSOLUTE, ext, 0, 0, x, y);
+            handle_position(ext->pointer1, x, y, false);
             break;
         }
 
+        case LIBINPUT_EVENT_TOUCH_MOTION:
         case LIBINPUT_EVENT_TOUCH_DOWN: {
             struct libinput_event_touch *touch_event = libinput_event_get_touch_event(event);
             int32_t slot = libinput_event_touch_get_slot(touch_event);
+            bool is_down = libinput_event_get_type(event) == LIBINPUT_EVENT_TOUCH_DOWN;
 
-            lv_indev_t *pointer;
-            if (slot <= 0)
-                pointer = ext->pointer1;
-            else if (slot == 1)
-                pointer = ext->pointer2;
-            else
+            lv_indev_t *pointer = get_touch_pointer(ext, slot);
+            if (!pointer)
                 break;
 
-            struct indev_ext *data = lv_indev_get_user_data(pointer);
             lv_display_t* display = lv_indev_get_display(pointer);
 
-            int32_t x = libinput_event_touch_get_x_transformed(touch_event, display->physical_hor_res);
-            int32_t y = libinput_event_touch_get_y_transformed(touch_event, display->physical_ver_res);
-            x -= display->offset_x;
-            y -= display->offset_y;
-            if (x < 0 || x >= display->hor_res || y < 0 || y >= display->ver_res)
-                break;
-            data->point.x = x;
-            data->point.y = y;
-            data->state = LV_INDEV_STATE_PRESSED;
+            uint32_t width, height;
+            get_panel_size(display, &width, &height);
 
-            lv_indev_read(pointer);
+            int32_t x = libinput_event_touch_get_x_transformed(touch_event, width);
+            int32_t y = libinput_event_touch_get_y_transformed(touch_event, height);
+            rotate_position(display, &x, &y);
+
+            record_event(is_down ? TRACE_TOUCH_DOWN : TRACE_TOUCH_MOTION, ext, slot, 0, x, y);
+            handle_position(pointer, x, y, is_down);
             break;
         }
 
@@ -570,18 +753,12 @@ static void on_input_event() {
             struct libinput_event_touch *touch_event = libinput_event_get_touch_event(event);
             int32_t slot = libinput_event_touch_get_slot(touch_event);
 
-            lv_indev_t *pointer;
-            if (slot <= 0)
-                pointer = ext->pointer1;
-            else if (slot == 1)
-                pointer = ext->pointer2;
-            else
+            lv_indev_t *pointer = get_touch_pointer(ext, slot);
+            if (!pointer)
                 break;
 
-            struct indev_ext *data = lv_indev_get_user_data(pointer);
-            data->state = LV_INDEV_STATE_RELEASED;
-
-            lv_indev_read(pointer);
+            record_event(TRACE_TOUCH_UP, ext, slot, 0, 0, 0);
+            handle_touch_up(pointer);
             break;
         }
 
@@ -591,12 +768,278 @@ static void on_input_event() {
 
         libinput_event_destroy(event);
     }
+
+    /* Keep the trace usable if the process gets killed */
+    if (record_file)
+        fflush(record_file);
+}
+
+static bool start_recording(const char* path) {
+    record_file = fopen(path, "we");
+    if (!record_file) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not open %s for recording input: %s", path, strerror(errno));
+        return false;
+    }
+
+    lv_display_t* display = lv_display_get_default();
+    struct trace_header header = {
+        .magic = TRACE_MAGIC,
+        .version = TRACE_VERSION,
+        .hor_res = display->physical_hor_res,
+        .ver_res = display->physical_ver_res
+    };
+    if (fwrite(&header, sizeof(header), 1, record_file) != 1) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not write input trace header to %s", path);
+        fclose(record_file);
+        record_file = NULL;
+        return false;
+    }
+
+    record_start = get_monotonic_time_us();
+    bbx_log(BBX_LOG_LEVEL_VERBOSE, "Recording input to %s", path);
+    return true;
 }
 
+static void replay_record(const struct trace_record* record) {
+    struct input_device_ext* ext = replay.devices[record->device];
+
+    if (record->type == TRACE_DEVICE_ADDED) {
+        if (ext)
+            destroy_device_extension(ext);
+        char name[sizeof("Replayed device 255")];
+        sprintf(name, "Replayed device %u", (unsigned) record->device);
+        replay.devices[record->device] = create_device_extension(
+            (enum input_device_type) (record->value & 0xff), record->value >> 8, name);
+        return;
+    }
+
+    if (!ext) {
+        bbx_log(BBX_LOG_LEVEL_WARNING, "Input trace refers to unknown device %u", (unsigned) record->device);
+        return;
+    }
+
+    /* Like libinput, drop events while input processing is suspended */
+    if (libinput_is_suspended && record->type != TRACE_DEVICE_REMOVED)
+        return;
+
+    switch (record->type) {
+    case TRACE_DEVICE_REMOVED:
+        destroy_device_extension(ext);
+        replay.devices[record->device] = NULL;
+        break;
+#ifndef BBX_APP_BUFFYBOARD
+    case TRACE_KEY_PRESSED:
+    case TRACE_KEY_RELEASED:
+        if (!ext->keypad)
+            break;
+        /* Never shut down the device because of a replayed trace */
+        if (record->value == KEY_POWER) {
+            bbx_log(BBX_LOG_LEVEL_VERBOSE, "Not replaying KEY_POWER");
+            break;
+        }
+        handle_key(ext, record->value, record->type == TRACE_KEY_PRESSED);
+        break;
+#endif
+    case TRACE_POINTER_MOTION:
+        if (ext->pointer1)
+            handle_pointer_motion(ext, record->x, record->y);
+        break;
+    case TRACE_POINTER_MOTION_ABSOLUTE:
+        if (ext->pointer1)
+            handle_position(ext->pointer1, record->x, record->y, false);
+        break;
+    case TRACE_POINTER_PRESSED:
+    case TRACE_POINTER_RELEASED:
+        if (ext->pointer1)
+            handle_pointer_button(ext, record->type == TRACE_POINTER_PRESSED);
+        break;
+    case TRACE_TOUCH_DOWN:
+    case TRACE_TOUCH_MOTION:
+    case TRACE_TOUCH_UP: {
+        lv_indev_t *pointer = get_touch_pointer(ext, record->slot);
+        if (!pointer)
+            break;
+        if (record->type == TRACE_TOUCH_UP)
+            handle_touch_up(pointer);
+        else
+            handle_position(pointer, record->x, record->y, record->type == TRACE_TOUCH_DOWN);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+static void finish_replay() {
+    /* Make sure that the result of the last event is on the screen */
+    lv_refr_now(NULL);
+
+    close(replay.fd_timer);
+    replay.fd_timer = -1;
+    bbx_log(BBX_LOG_LEVEL_VERBOSE, "Input replay finished");
+    if (on_replay_finished_cb)
+        on_replay_finished_cb();
+}
+
+static void schedule_replay() {
+    struct itimerspec spec = { 0 };
+    int flags = 0;
+    if (replay.is_fast || replay.next_record == replay.num_records) {
+        /* Expire immediately, but only after the main loop got a chance to run LVGL's timers */
+        spec.it_value.tv_nsec = 1;
+    } else {
+        uint64_t time = replay.start + replay.records[replay.next_record].time;
+        spec.it_value.tv_sec = time / 1000000;
+        spec.it_value.tv_nsec = time % 1000000 * 1000;
+        /* A zero it_value would disarm the timer */
+        if (spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0)
+            spec.it_value.tv_nsec = 1;
+        flags = TFD_TIMER_ABSTIME;
+    }
+
+    if (timerfd_settime(replay.fd_timer, flags, &spec, NULL) != 0)
+        bbx_log(BBX_LOG_LEVEL_ERROR, "timerfd_settime() is failed: %s", strerror(errno));
+}
+
+static void on_replay_timer() {
+    uint64_t expirations;
+    if (read(replay.fd_timer, &expirations, sizeof(expirations)) < 0 && errno == EAGAIN)
+        return;
+
+    if (replay.next_record == replay.num_records) {
+        finish_replay();
+        return;
+    }
+
+    if (replay.is_fast) {
+        /* Render the result of every event so that runs do the same amount of work regardless of timing */
+        replay_record(&replay.records[replay.next_record++]);
+        lv_refr_now(NULL);
+    } else {
+        uint64_t now = get_monotonic_time_us() - replay.start;
+        while (replay.next_record < replay.num_records && replay.records[replay.next_record].time <= now)
+            replay_record(&replay.records[replay.next_record++]);
+    }
+
+    schedule_replay();
+}
+
+static bool load_trace(const char* path) {
+    FILE* file = fopen(path, "re");
+    if (!file) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not open input trace %s: %s", path, strerror(errno));
+        return false;
+    }
+
+    struct trace_header header;
+    struct stat buffer;
+    if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, TRACE_MAGIC, sizeof(header.magic)) != 0) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "%s is not an input trace", path);
+        goto failure;
+    }
+    if (header.version != TRACE_VERSION) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Input trace %s has unsupported version %u", path, (unsigned) header.version);
+        goto failure;
+    }
+    if (fstat(fileno(file), &buffer) != 0) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "fstat(%s) is failed: %s", path, strerror(errno));
+        goto failure;
+    }
+
+    lv_display_t* display = lv_display_get_default();
+    if (header.hor_res != display->physical_hor_res || header.ver_res != display->physical_ver_res) {
+        bbx_log(BBX_LOG_LEVEL_WARNING, "Input trace %s was recorded at %dx%d, absolute coordinates will be off",
+            path, (int) header.hor_res, (int) header.ver_res);
+    }
+
+    /* A trace that was cut short by killing the recording process may end with a partial record */
+    replay.num_records = (buffer.st_size - sizeof(header)) / sizeof(struct trace_record);
+    replay.records = malloc(replay.num_records ? replay.num_records * sizeof(struct trace_record) : 1);
+    if (!replay.records) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for input trace");
+        goto failure;
+    }
+    if (fread(replay.records, sizeof(struct trace_record), replay.num_records, file) != replay.num_records) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not read input trace %s", path);
+        free(replay.records);
+        replay.records = NULL;
+        goto failure;
+    }
+
+    fclose(file);
+    bbx_log(BBX_LOG_LEVEL_VERBOSE, "Replaying %zu input events from %s", replay.num_records, path);
+    return true;
+
+failure:
+    fclose(file);
+    return false;
+}
+
+static uint8_t init_replay(int fd_epoll, const struct bbx_indev_opts* opts) {
+    if (!load_trace(opts->replay_path))
+        return 0;
+
+    replay.is_fast = opts->replay_fast;
+    replay.start = get_monotonic_time_us();
+
+    /* Devices that were connected when the recording started are needed right away, e.g. to tell if
+       there is a keyboard */
+    while (replay.next_record < replay.num_records &&
+           replay.records[replay.next_record].type == TRACE_DEVICE_ADDED)
+        replay_record(&replay.records[replay.next_record++]);
+
+    replay.fd_timer = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    if (replay.fd_timer == -1) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "timerfd_create() is failed: %s", strerror(errno));
+        return 0;
+    }
+
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = __extension__ (void*) on_replay_timer;
+
+    if (epoll_ctl(fd_epoll, EPOLL_CTL_ADD, replay.fd_timer, &event) == -1) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "EPOLL_CTL_ADD for input replay timer is failed");
+        return 0;
+    }
+
+    schedule_replay();
+    return 1;
+}
+
+static bool is_input_device_attached(struct udev_device* device) {
+    const char* sysname = udev_device_get_sysname(device);
+    for (struct input_device_ext* ext = attached_devices; ext; ext = ext->next) {
+        if (strcmp(libinput_device_get_sysname(ext->device), sysname) == 0)
+            return true;
+    }
+    return false;
+}
+
+static bool is_input_device_type_enabled(enum input_device_type type) {
+    switch (type) {
+    case BBX_INDEV_KEYBOARD:
+#ifndef BBX_APP_BUFFYBOARD
+        return options.keyboard;
+#else
+        return false;
+#endif
+    case BBX_INDEV_MOUSE:
+    case BBX_INDEV_TOUCHPAD:
+        return options.pointer;
+    case BBX_INDEV_TOUCHSCREEN:
+        return options.touchscreen;
+    default:
+        return true;
+    }
+}
 
 static void attach_input_device(struct udev_device* device) {
     const char* node = udev_device_get_devnode(device);
 
+    if (is_input_device_attached(device))
+        return;
+
     enum input_device_type type = identify_input_device(device);
     switch (type) {
     case BBX_INDEV_NONE:
@@ -729,35 +1172,11 @@ uint8_t bbx_indev_init(int fd_epoll, const struct bbx_indev_opts* opts) {
         .close_restricted = close_restricted,
     };
 
-    context_libinput = libinput_path_create_context(&interface, NULL);
-    if (!context_libinput) {
-        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not create libinput context");
-        return 0;
-    }
-
-    context_udev = udev_new();
-    if (!context_udev) {
-        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not create udev context");
-        goto failure1;
-    }
-
-    monitor = udev_monitor_new_from_netlink(context_udev, "udev");
-    if (!monitor) {
-        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not create udev monitor");
-        goto failure2;
-    }
-
-    if (udev_monitor_filter_add_match_subsystem_devtype(monitor, "input", NULL) != 0)
-        bbx_log(BBX_LOG_LEVEL_WARNING, "Could not add a filter for udev monitor");
-
-    if (udev_monitor_filter_update(monitor) != 0)
-        bbx_log(BBX_LOG_LEVEL_WARNING, "Could not update a filter for udev monitor");
-
 #ifndef BBX_APP_BUFFYBOARD
     struct xkb_context *context_xkb = xkb_context_new(XKB_CONTEXT_NO_FLAGS);
     if (!context_xkb) {
         bbx_log(BBX_LOG_LEVEL_ERROR, "Could not create xkb_context");
-        goto failure3;
+        return 0;
     }
 
     keymap = xkb_keymap_new_from_names(context_xkb, opts->keymap, XKB_KEYMAP_COMPILE_NO_FLAGS);
@@ -768,7 +1187,7 @@ uint8_t bbx_indev_init(int fd_epoll, const struct bbx_indev_opts* opts) {
             opts->keymap->layout,
             opts->keymap->variant,
             opts->keymap->options);
-        goto failure4;
+        goto failure1;
     }
 #endif
 
@@ -779,7 +1198,7 @@ uint8_t bbx_indev_init(int fd_epoll, const struct bbx_indev_opts* opts) {
     mouse_cursor = lv_image_create(lv_display_get_layer_sys(display));
     if (!mouse_cursor) {
         bbx_log(BBX_LOG_LEVEL_ERROR, "lv_image_create() is failed");
-        goto failure5;
+        goto failure2;
     }
     lv_obj_add_flag(mouse_cursor, LV_OBJ_FLAG_HIDDEN);
     lv_image_set_src(mouse_cursor, &cursor);
@@ -788,14 +1207,50 @@ uint8_t bbx_indev_init(int fd_epoll, const struct bbx_indev_opts* opts) {
     keyboard_input_group = lv_group_create();
     if (!keyboard_input_group) {
         bbx_log(BBX_LOG_LEVEL_ERROR, "lv_group_create() is failed");
-        goto failure6;
+        goto failure3;
     }
 
     options.keyboard = opts->keyboard;
+    rotation = opts->rotation;
 #endif
     options.pointer = opts->pointer;
     options.touchscreen = opts->touchscreen;
 
+    /* Replayed events bypass libinput entirely */
+    if (opts->replay_path) {
+        if (opts->record_path)
+            bbx_log(BBX_LOG_LEVEL_WARNING, "Input is not recorded while replaying a trace");
+        return init_replay(fd_epoll, opts);
+    }
+
+    context_libinput = libinput_path_create_context(&interface, NULL);
+    if (!context_libinput) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not create libinput context");
+        goto failure4;
+    }
+
+    context_udev = udev_new();
+    if (!context_udev) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not create udev context");
+        goto failure5;
+    }
+
+    monitor = udev_monitor_new_from_netlink(context_udev, "udev");
+    if (!monitor) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not create udev monitor");
+        goto failure6;
+    }
+
+    if (udev_monitor_filter_add_match_subsystem_devtype(monitor, "input", NULL) != 0)
+        bbx_log(BBX_LOG_LEVEL_WARNING, "Could not add a filter for udev monitor");
+
+    if (udev_monitor_filter_update(monitor) != 0)
+        bbx_log(BBX_LOG_LEVEL_WARNING, "Could not update a filter for udev monitor");
+
+    /* Start recording before attaching devices so that the trace knows about them */
+    if (opts->record_path && !start_recording(opts->record_path))
+        goto failure7;
+
     attach_input_devices();
 
     uint8_t ret = 0;
@@ -824,28 +1279,32 @@ uint8_t bbx_indev_init(int fd_epoll, const struct bbx_indev_opts* opts) {
     return ret;
 
 
-#ifndef BBX_APP_BUFFYBOARD
+failure7:
+    udev_monitor_unref(monitor);
 failure6:
-    lv_obj_delete(mouse_cursor);
-#endif
+    udev_unref(context_udev);
 failure5:
-#ifndef BBX_APP_BUFFYBOARD
-    xkb_keymap_unref(keymap);
+    libinput_unref(context_libinput);
+    context_libinput = NULL;
 failure4:
-    xkb_context_unref(context_xkb);
+#ifndef BBX_APP_BUFFYBOARD
+    lv_group_delete(keyboard_input_group);
 failure3:
 #endif
-    udev_monitor_unref(monitor);
+    lv_obj_delete(mouse_cursor);
 failure2:
-    udev_unref(context_udev);
+#ifndef BBX_APP_BUFFYBOARD
+    xkb_keymap_unref(keymap);
 failure1:
-    libinput_unref(context_libinput);
+    xkb_context_unref(context_xkb);
+#endif
     return 0;
 }
 
 void bbx_indev_suspend() {
     if (!libinput_is_suspended) {
-        libinput_suspend(context_libinput);
+        if (context_libinput)
+            libinput_suspend(context_libinput);
         libinput_is_suspended = true;
         bbx_log(BBX_LOG_LEVEL_VERBOSE, "libinput is suspended");
     }
@@ -853,12 +1312,39 @@ void bbx_indev_suspend() {
 
 void bbx_indev_resume() {
     if (libinput_is_suspended) {
-        libinput_resume(context_libinput);
+        if (context_libinput)
+            libinput_resume(context_libinput);
         libinput_is_suspended = false;
         bbx_log(BBX_LOG_LEVEL_VERBOSE, "libinput is resumed");
     }
 }
 
+void bbx_indev_set_filters(const struct bbx_indev_opts* opts) {
+#ifndef BBX_APP_BUFFYBOARD
+    options.keyboard = opts->keyboard;
+#endif
+    options.pointer = opts->pointer;
+    options.touchscreen = opts->touchscreen;
+
+    /* Replayed devices are used as recorded */
+    if (!context_libinput)
+        return;
+
+    /* Detach devices that are filtered out now. Their extensions are released with LIBINPUT_EVENT_DEVICE_REMOVED. */
+    for (struct input_device_ext* ext = attached_devices; ext; ext = ext->next) {
+        if (!is_input_device_type_enabled(ext->type)) {
+            bbx_log(BBX_LOG_LEVEL_VERBOSE, "Detaching %s", libinput_device_get_sysname(ext->device));
+            libinput_path_remove_device(ext->device);
+        }
+    }
+    on_input_event();
+
+    /* Attach devices that were filtered out before */
+    attach_input_devices();
+    if (libinput_is_suspended)
+        libinput_suspend(context_libinput);
+}
+
 #ifndef BBX_APP_BUFFYBOARD
 bool bbx_indev_is_keyboard_connected() {
     return num_keyboards != 0;
@@ -868,3 +1354,7 @@ void bbx_indev_set_key_power_cb(void (*callback)()) {
     on_key_power_cb = callback;
 }
 #endif
+
+void bbx_indev_set_replay_finished_cb(void (*callback)()) {
+    on_replay_finished_cb = callback;
+}
@@ -17,9 +17,19 @@ struct bbx_indev_opts {
 #ifndef BBX_APP_BUFFYBOARD
     struct xkb_rule_names* keymap;
     uint8_t keyboard : 1;
+    /* Rotation of the UI relative to the panel that is applied by the display backend rather than LVGL.
+       Positions of touchscreens and other absolute pointing devices are rotated to match. Only taken into
+       account by bbx_indev_init, bbx_indev_set_filters leaves the rotation as it is. */
+    lv_display_rotation_t rotation;
 #endif
     uint8_t pointer : 1;
     uint8_t touchscreen : 1;
+    /* Path to record consumed input events to or NULL */
+    const char* record_path;
+    /* Path of a recorded trace to replay instead of using libinput or NULL */
+    const char* replay_path;
+    /* Replay events as fast as possible instead of in real time, rendering after each of them */
+    bool replay_fast;
 };
 
 #ifndef BBX_APP_BUFFYBOARD
@@ -28,7 +38,8 @@ extern lv_group_t *keyboard_input_group;
 #endif
 
 /**
- * Attach input devices from /dev/input/event* and set up monitoring for new devices.
+ * Attach input devices from /dev/input/event* and set up monitoring for new devices. If opts->replay_path
+ * is set, the devices and events of the recorded trace are replayed instead.
  *
  * @param fd_epoll epoll descriptor to add monitored events to
  * @param opts options for filtering input devices and setting a keyboard keymap
@@ -36,6 +47,14 @@ extern lv_group_t *keyboard_input_group;
  */
 uint8_t bbx_indev_init(int fd_epoll, const struct bbx_indev_opts* opts);
 
+/**
+ * Change which kinds of input devices are used. Devices that are filtered out now are detached and
+ * connected devices that were filtered out before are attached. The keymap and the rotation cannot be changed.
+ *
+ * @param opts options for filtering input devices
+ */
+void bbx_indev_set_filters(const struct bbx_indev_opts* opts);
+
 /**
  * Stop input processing.
  */
@@ -60,4 +79,9 @@ bool bbx_indev_is_keyboard_connected();
 void bbx_indev_set_key_power_cb(void (*callback)());
 #endif
 
+/**
+ * Set a function that will be called once all events of a replayed trace have been processed.
+ */
+void bbx_indev_set_replay_finished_cb(void (*callback)());
+
 #endif /* BBX_INDEV_H */
@@ -7,6 +7,78 @@
 #include "theme.h"
 #include "../squeek2lvgl/sq2lv.h"
 
+/**
+ * Static prototypes
+ */
+
+/**
+ * Get the vertical offset of a row relative to the keyboard's content area, mirroring LVGL's layout.
+ *
+ * @param row row index
+ * @param num_rows total number of rows
+ * @param height content height without row gaps
+ * @param pad_row gap between rows
+ * @return offset of the row's top edge
+ */
+static int32_t get_row_offset(int row, int num_rows, int32_t height, int32_t pad_row);
+
+/**
+ * Get the horizontal offset of a key relative to the keyboard's content area, mirroring LVGL's layout.
+ *
+ * @param key key index within its row
+ * @param units number of width units preceding the key in its row
+ * @param num_units total number of width units in the row
+ * @param width content width without column gaps
+ * @param pad_column gap between keys
+ * @return offset of the key's left edge
+ */
+static int32_t get_key_offset(int key, int32_t units, int32_t num_units, int32_t width, int32_t pad_column);
+
+/**
+ * Handle LV_EVENT_PRESSING before the keyboard's own handler. Skips LVGL's linear scan over all button
+ * areas while the pointer remains on the selected key.
+ *
+ * @param event the event object
+ */
+static void keyboard_pressing_preprocess_cb(lv_event_t *event);
+
+
+/**
+ * Static functions
+ */
+
+static int32_t get_row_offset(int row, int num_rows, int32_t height, int32_t pad_row) {
+    return (height * row) / num_rows + row * pad_row;
+}
+
+static int32_t get_key_offset(int key, int32_t units, int32_t num_units, int32_t width, int32_t pad_column) {
+    return (width * units) / num_units + key * pad_column;
+}
+
+static void keyboard_pressing_preprocess_cb(lv_event_t *event) {
+    lv_indev_t *indev = lv_indev_active();
+    if (!indev || lv_indev_get_type(indev) != LV_INDEV_TYPE_POINTER) {
+        return;
+    }
+
+    lv_obj_t *keyboard = lv_event_get_target(event);
+    uint32_t btn_id = lv_buttonmatrix_get_selected_button(keyboard);
+    if (btn_id == LV_BUTTONMATRIX_BUTTON_NONE) {
+        return;
+    }
+
+    lv_point_t point;
+    lv_indev_get_point(indev, &point);
+    if (bbx_keyboard_get_button_at_point(keyboard, &point) == btn_id) {
+        lv_event_stop_processing(event);
+    }
+}
+
+
+/**
+ * Public functions
+ */
+
 void bbx_keyboard_init_config(bbx_keyboard_config_t *config) {
     config->mode = LV_KEYBOARD_MODE_TEXT_LOWER;
     config->layout_id = 0;  /* Default to first layout */
@@ -39,6 +111,9 @@ lv_obj_t *bbx_keyboard_create(lv_obj_t *parent, lv_obj_t *textarea, bbx_keyboard
         lv_obj_add_event_cb(keyboard, config->ready_callback, LV_EVENT_READY, NULL);
     }
 
+    /* Resolve pointer movement within a key using the precomputed layer geometry */
+    lv_obj_add_event_cb(keyboard, keyboard_pressing_preprocess_cb, LV_EVENT_PRESSING | LV_EVENT_PREPROCESS, NULL);
+
     /* Set size */
     if (config->height > 0) {
         lv_obj_set_size(keyboard, LV_PCT(100), config->height);
@@ -57,3 +132,68 @@ lv_obj_t *bbx_keyboard_create(lv_obj_t *parent, lv_obj_t *textarea, bbx_keyboard
 
     return keyboard;
 }
+
+uint32_t bbx_keyboard_get_button_at_point(lv_obj_t *keyboard, const lv_point_t *point) {
+    const sq2lv_layer_geometry_t *geometry = sq2lv_get_layer_geometry(keyboard);
+    if (!geometry || lv_obj_get_style_base_dir(keyboard, LV_PART_MAIN) == LV_BASE_DIR_RTL) {
+        return LV_BUTTONMATRIX_BUTTON_NONE;
+    }
+
+    lv_area_t coords;
+    lv_obj_get_coords(keyboard, &coords);
+    int32_t x = point->x - coords.x1 - lv_obj_get_style_space_left(keyboard, LV_PART_MAIN);
+    int32_t y = point->y - coords.y1 - lv_obj_get_style_space_top(keyboard, LV_PART_MAIN);
+    if (x < 0 || y < 0) {
+        return LV_BUTTONMATRIX_BUTTON_NONE;
+    }
+
+    int32_t pad_row = lv_obj_get_style_pad_row(keyboard, LV_PART_MAIN);
+    int32_t pad_column = lv_obj_get_style_pad_column(keyboard, LV_PART_MAIN);
+    int32_t height = lv_obj_get_content_height(keyboard) - pad_row * (geometry->num_rows - 1);
+
+    /* Find the last row starting at or above the point */
+    int low = 0;
+    int high = geometry->num_rows - 1;
+    while (low < high) {
+        int mid = (low + high + 1) / 2;
+        if (get_row_offset(mid, geometry->num_rows, height, pad_row) <= y) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+
+    int row = low;
+    if (y >= get_row_offset(row + 1, geometry->num_rows, height, pad_row) - pad_row) {
+        return LV_BUTTONMATRIX_BUTTON_NONE; /* Gap below the row or outside the keyboard */
+    }
+
+    int first = geometry->row_starts[row];
+    int num_keys = geometry->row_starts[row + 1] - first;
+    if (num_keys == 0) {
+        return LV_BUTTONMATRIX_BUTTON_NONE;
+    }
+
+    const uint16_t *unit_ends = &(geometry->unit_ends[first]);
+    int32_t num_units = unit_ends[num_keys - 1];
+    int32_t width = LV_MAX(lv_obj_get_content_width(keyboard) - pad_column * (num_keys - 1), 0);
+
+    /* Find the last key starting at or left of the point */
+    low = 0;
+    high = num_keys - 1;
+    while (low < high) {
+        int mid = (low + high + 1) / 2;
+        if (get_key_offset(mid, unit_ends[mid - 1], num_units, width, pad_column) <= x) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+
+    int key = low;
+    if (x >= get_key_offset(key, unit_ends[key], num_units, width, pad_column)) {
+        return LV_BUTTONMATRIX_BUTTON_NONE; /* Gap to the right of the key or outside the keyboard */
+    }
+
+    return first + key;
+}
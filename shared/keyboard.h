@@ -16,4 +16,13 @@ typedef struct {
 lv_obj_t *bbx_keyboard_create(lv_obj_t *parent, lv_obj_t *textarea, bbx_keyboard_config_t *config);
 void bbx_keyboard_init_config(bbx_keyboard_config_t *config);
 
+/**
+ * Resolve a point to the key underneath it in O(log n) using the current layer's precomputed geometry.
+ *
+ * @param keyboard keyboard widget
+ * @param point point in screen coordinates
+ * @return button index or LV_BUTTONMATRIX_BUTTON_NONE if the point isn't on a key
+ */
+uint32_t bbx_keyboard_get_button_at_point(lv_obj_t *keyboard, const lv_point_t *point);
+
 #endif /* BBX_KEYBOARD_H */
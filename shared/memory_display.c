@@ -0,0 +1,253 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "memory_display.h"
+
+#include "log.h"
+
+#include <sys/mman.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/**
+ * State of a memory display
+ */
+typedef struct {
+    /* Display that renders into the buffer */
+    lv_display_t *disp;
+    /* Render buffer */
+    uint8_t *buf;
+    size_t buf_size;
+    uint32_t stride;
+    lv_color_format_t color_format;
+    /* Path of the PPM file to dump into or NULL */
+    char *path;
+    /* True if the next complete frame is to be dumped */
+    bool is_dump_pending;
+    /* Number of completely rendered frames */
+    uint64_t frames;
+    /* Number of pixels passed to the flush callback */
+    uint64_t pixels;
+} memory_display;
+
+/**
+ * Static variables
+ */
+
+/* Most recently created memory display */
+static memory_display *last_state = NULL;
+
+/**
+ * Static prototypes
+ */
+
+/**
+ * Handle flushing of a rendered area.
+ *
+ * @param disp display
+ * @param area rendered area
+ * @param px_map render buffer
+ */
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
+
+/**
+ * Convert a row of native pixels to packed RGB.
+ *
+ * @param src native pixels
+ * @param dst buffer to write 3 bytes per pixel into
+ * @param width number of pixels
+ * @param color_format color format of the native pixels
+ */
+static void convert_row(const uint8_t *src, uint8_t *dst, int32_t width, lv_color_format_t color_format);
+
+/**
+ * Write the complete screen into the display's PPM file, going through a temporary file.
+ *
+ * @param state state of the display
+ * @return true on success, false otherwise
+ */
+static bool write_dump(const memory_display *state);
+
+/**
+ * Log the rendering statistics of the most recently created memory display.
+ */
+static void log_stats(void);
+
+/**
+ * Static functions
+ */
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    LV_UNUSED(px_map);
+    memory_display *state = lv_display_get_driver_data(disp);
+
+    state->pixels += (uint64_t)lv_area_get_width(area) * lv_area_get_height(area);
+    if (lv_display_flush_is_last(disp)) {
+        state->frames++;
+
+        /* In direct mode, the buffer holds the whole screen once the last area of a frame has been rendered */
+        if (state->is_dump_pending) {
+            state->is_dump_pending = false;
+            write_dump(state);
+        }
+    }
+
+    lv_display_flush_ready(disp);
+}
+
+static void convert_row(const uint8_t *src, uint8_t *dst, int32_t width, lv_color_format_t color_format) {
+    if (color_format == LV_COLOR_FORMAT_RGB565) {
+        const lv_color16_t *pixels = (const lv_color16_t *)src;
+        for (int32_t x = 0; x < width; ++x) {
+            /* Replicate the high bits into the low bits so that full intensity stays full intensity */
+            dst[3 * x] = (pixels[x].red << 3) | (pixels[x].red >> 2);
+            dst[3 * x + 1] = (pixels[x].green << 2) | (pixels[x].green >> 4);
+            dst[3 * x + 2] = (pixels[x].blue << 3) | (pixels[x].blue >> 2);
+        }
+        return;
+    }
+
+    const lv_color32_t *pixels = (const lv_color32_t *)src;
+    for (int32_t x = 0; x < width; ++x) {
+        dst[3 * x] = pixels[x].red;
+        dst[3 * x + 1] = pixels[x].green;
+        dst[3 * x + 2] = pixels[x].blue;
+    }
+}
+
+static bool write_dump(const memory_display *state) {
+    int32_t hor_res = lv_display_get_horizontal_resolution(state->disp);
+    int32_t ver_res = lv_display_get_vertical_resolution(state->disp);
+
+    size_t path_length = strlen(state->path);
+    char tmp_path[path_length + sizeof(".tmp")];
+    memcpy(tmp_path, state->path, path_length);
+    memcpy(tmp_path + path_length, ".tmp", sizeof(".tmp"));
+
+    FILE *file = fopen(tmp_path, "we");
+    if (!file) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not open %s: %s", tmp_path, strerror(errno));
+        return false;
+    }
+
+    uint8_t *row = malloc((size_t)hor_res * 3);
+    bool ok = row != NULL;
+    ok = ok && fprintf(file, "P6\n%d %d\n255\n", (int)hor_res, (int)ver_res) > 0;
+    for (int32_t y = 0; ok && y < ver_res; ++y) {
+        convert_row(state->buf + y * state->stride, row, hor_res, state->color_format);
+        ok = fwrite(row, 3, hor_res, file) == (size_t)hor_res;
+    }
+    free(row);
+
+    if (fclose(file) != 0) {
+        ok = false;
+    }
+    if (ok && rename(tmp_path, state->path) != 0) {
+        ok = false;
+    }
+    if (!ok) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not write %s", state->path);
+        unlink(tmp_path);
+        return false;
+    }
+
+    bbx_log(BBX_LOG_LEVEL_VERBOSE, "Dumped frame %" PRIu64 " into %s", state->frames, state->path);
+    return true;
+}
+
+static void log_stats(void) {
+    bbx_log(BBX_LOG_LEVEL_VERBOSE, "Memory display statistics: %" PRIu64 " frames, %" PRIu64 " pixels",
+        last_state->frames, last_state->pixels);
+}
+
+/**
+ * Public functions
+ */
+
+lv_display_t *bbx_memory_display_create(int32_t hor_res, int32_t ver_res, int bpp, const char *path) {
+    lv_color_format_t color_format;
+    switch (bpp) {
+    case 16:
+#if LV_DRAW_SW_SUPPORT_RGB565
+        color_format = LV_COLOR_FORMAT_RGB565;
+        break;
+#else
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Rendering with 16 bits per pixel requires building with RGB565 support");
+        return NULL;
+#endif /* LV_DRAW_SW_SUPPORT_RGB565 */
+    case 32:
+        color_format = LV_COLOR_FORMAT_XRGB8888;
+        break;
+    default:
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Unsupported number of bits per pixel: %d", bpp);
+        return NULL;
+    }
+
+    memory_display *state = calloc(1, sizeof(memory_display));
+    if (!state) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for memory display");
+        return NULL;
+    }
+
+    lv_display_t *disp = lv_display_create(hor_res, ver_res);
+    if (!disp) {
+        free(state);
+        return NULL;
+    }
+
+    lv_display_set_color_format(disp, color_format);
+    state->color_format = color_format;
+    state->stride = lv_draw_buf_width_to_stride(hor_res, color_format);
+    state->buf_size = (size_t)state->stride * ver_res;
+    state->buf = mmap(NULL, state->buf_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (state->buf == MAP_FAILED) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not map render buffer: %s", strerror(errno));
+        goto error;
+    }
+
+    if (path) {
+        state->path = strdup(path);
+        if (!state->path) {
+            bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for memory display");
+            goto error;
+        }
+    }
+
+    state->disp = disp;
+    lv_display_set_driver_data(disp, state);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_buffers(disp, state->buf, NULL, state->buf_size, LV_DISPLAY_RENDER_MODE_DIRECT);
+
+    /* Report what has been rendered when the application exits, e.g. for benchmarks */
+    if (!last_state) {
+        atexit(log_stats);
+    }
+    last_state = state;
+    return disp;
+
+error:
+    if (state->buf && state->buf != MAP_FAILED) {
+        munmap(state->buf, state->buf_size);
+    }
+    free(state->path);
+    free(state);
+    lv_display_delete(disp);
+    return NULL;
+}
+
+bool bbx_memory_display_request_dump(void) {
+    if (!last_state || !last_state->path) {
+        return false;
+    }
+
+    /* Force a new frame so that the dump doesn't depend on anything else changing on screen */
+    last_state->is_dump_pending = true;
+    lv_obj_invalidate(lv_display_get_screen_active(last_state->disp));
+    return true;
+}
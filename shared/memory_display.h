@@ -0,0 +1,48 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef BBX_MEMORY_DISPLAY_H
+#define BBX_MEMORY_DISPLAY_H
+
+#include "lvgl/lvgl.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Memory display
+ *
+ * A headless display that renders into an anonymous memory buffer. It needs neither a framebuffer nor a DRM
+ * device and is meant for benchmarks and rendering tests. Optionally, the screen can be dumped on demand into a
+ * binary PPM (P6) file. A dump is written after the last flush of a frame into a temporary file that is then
+ * renamed into place, so readers only ever see complete frames.
+ *
+ * The numbers of frames and pixels rendered by the most recently created memory display are logged when the
+ * application exits, which is how benchmarks collect them.
+ */
+
+#define BBX_MEMORY_DISPLAY_DEFAULT_HOR_RES 800
+#define BBX_MEMORY_DISPLAY_DEFAULT_VER_RES 480
+#define BBX_MEMORY_DISPLAY_DEFAULT_BPP 32
+
+/**
+ * Create a memory display.
+ *
+ * @param hor_res horizontal resolution in pixels
+ * @param ver_res vertical resolution in pixels
+ * @param bpp bits per pixel to render with, 16 for RGB565 or 32 for XRGB8888
+ * @param path path of the PPM file to dump the screen into or NULL to only render into memory
+ * @return the display or NULL on failure
+ */
+lv_display_t *bbx_memory_display_create(int32_t hor_res, int32_t ver_res, int bpp, const char *path);
+
+/**
+ * Redraw the most recently created memory display and dump the frame into its PPM file once it is complete.
+ *
+ * @return true if a dump was scheduled, false if there is no memory display or it has no PPM file
+ */
+bool bbx_memory_display_request_dump(void);
+
+#endif /* BBX_MEMORY_DISPLAY_H */
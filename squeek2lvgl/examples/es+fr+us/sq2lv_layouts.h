@@ -9,11 +9,6 @@
 
 #define SQ2LV_SCANCODES_ENABLED 0
 
-/* Key attributes */
-#define SQ2LV_CTRL_NON_CHAR     (LV_BTNMATRIX_CTRL_CLICK_TRIG | LV_BTNMATRIX_CTRL_CHECKED)
-#define SQ2LV_CTRL_MOD_ACTIVE   (LV_BTNMATRIX_CTRL_CLICK_TRIG | LV_BTNMATRIX_CTRL_CHECKABLE)
-#define SQ2LV_CTRL_MOD_INACTIVE (LV_BTNMATRIX_CTRL_CLICK_TRIG | LV_BTNMATRIX_CTRL_CHECKABLE | LV_BTNMATRIX_CTRL_CHECKED)
-
 /* Layout IDs, values can be used as indexes into the sq2lv_layouts array */
 typedef enum {
     SQ2LV_LAYOUT_NONE = -1,
@@ -29,7 +24,7 @@ typedef struct {
     /* Key caps */
     const char * const * const keycaps;
     /* Key attributes */
-    const lv_btnmatrix_ctrl_t * const attributes;
+    const lv_buttonmatrix_ctrl_t * const attributes;
     /* Number of modifier keys */
     const int num_modifiers;
     /* Button indexes of modifier keys */
@@ -37,9 +32,9 @@ typedef struct {
     /* Number of buttons that trigger a layer switch */
     const int num_switchers;
     /* Button indexes that trigger a layer switch */
-    const int * const switcher_idxs;
+    const uint16_t * const switcher_idxs;
     /* Indexes of layers to jump to when triggering layer switch buttons */
-    const int * const switcher_dests;
+    const uint16_t * const switcher_dests;
 } sq2lv_layer_t;
 
 /* Layout type */
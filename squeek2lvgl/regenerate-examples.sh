@@ -8,23 +8,29 @@ pipenv install
 
 pipenv run python squeek2lvgl.py \
     --input us.yaml \
+      --name "US English" \
     --output examples/us \
     --surround-space-with-arrows
 
 pipenv run python squeek2lvgl.py \
     --input de.yaml \
+      --name "German" \
     --output examples/de-with-custom-shift-keycap \
     --surround-space-with-arrows \
     --shift-keycap ABC
 
 pipenv run python squeek2lvgl.py \
     --input es.yaml \
+      --name "Spanish" \
     --input fr.yaml \
+      --name "French" \
     --input us.yaml \
+      --name "US English" \
     --output examples/es+fr+us \
     --surround-space-with-arrows
 
 pipenv run python squeek2lvgl.py \
     --input terminal/us.yaml \
+      --name "US English (Terminal)" \
     --output examples/us-terminal-with-scancodes \
     --generate-scancodes
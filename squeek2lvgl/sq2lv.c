@@ -6,15 +6,34 @@
 
 #include "sq2lv.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 
+/**
+ * Defines
+ */
+
+/* Bits in key attributes that hold the relative key width */
+#define WIDTH_MASK 0x000F
+
+
 /**
  * Static variables
  */
 
 static sq2lv_layout_id_t current_layout_id = SQ2LV_LAYOUT_NONE;
 
+/* Maximum number of layers that can be mapped onto LVGL keyboard modes */
+#define MAX_LAYERS 8
+
+/* Lazily computed layer geometries, indexed by layout ID */
+static sq2lv_layer_geometry_t **layout_geometries = NULL;
+
+/* Maps most recently assigned to each keyboard mode. LVGL keeps these maps globally, not per widget. */
+static const char * const *assigned_keycaps[MAX_LAYERS];
+static const lv_buttonmatrix_ctrl_t *assigned_attributes[MAX_LAYERS];
+
 
 /**
  * Static prototypes
@@ -53,6 +72,31 @@ static int get_layer_index(lv_obj_t *keyboard);
  */
 static int get_destination_layer_index_for_layer_switcher(lv_obj_t *keyboard, uint16_t btn_id);
 
+/**
+ * Get the relative width of a key in units.
+ *
+ * @param attributes the key's attributes
+ * @return width in units (an unset width counts as 1 unit)
+ */
+static int get_key_width(lv_buttonmatrix_ctrl_t attributes);
+
+/**
+ * Compute row boundaries and cumulative key widths for a layer.
+ *
+ * @param layer layer to process
+ * @param geometry geometry struct to populate
+ * @return true on success, false if memory could not be allocated
+ */
+static bool compute_layer_geometry(const sq2lv_layer_t *layer, sq2lv_layer_geometry_t *geometry);
+
+/**
+ * Get the layer geometries of a layout, computing them on first use.
+ *
+ * @param layout_id layout ID
+ * @return array of layer geometries or NULL if memory could not be allocated
+ */
+static const sq2lv_layer_geometry_t *get_layout_geometries(sq2lv_layout_id_t layout_id);
+
 
 /**
  * Static functions
@@ -127,6 +171,71 @@ static int get_destination_layer_index_for_layer_switcher(lv_obj_t *keyboard, ui
     return -1;
 }
 
+static int get_key_width(lv_buttonmatrix_ctrl_t attributes) {
+    int width = attributes & WIDTH_MASK;
+    return width != 0 ? width : 1;
+}
+
+static bool compute_layer_geometry(const sq2lv_layer_t *layer, sq2lv_layer_geometry_t *geometry) {
+    /* Rows are separated by "\n" entries and the map is terminated by an empty string */
+    int num_rows = 1;
+    for (const char * const *keycap = layer->keycaps; (*keycap)[0] != '\0'; ++keycap) {
+        if (strcmp(*keycap, "\n") == 0) {
+            ++num_rows;
+        }
+    }
+
+    uint16_t *row_starts = malloc((num_rows + 1) * sizeof(uint16_t));
+    uint16_t *unit_ends = malloc((layer->num_keys + 1) * sizeof(uint16_t));
+    if (!row_starts || !unit_ends) {
+        free(row_starts);
+        free(unit_ends);
+        return false;
+    }
+
+    int row = 0;
+    int key = 0;
+    int units = 0;
+    row_starts[0] = 0;
+    for (const char * const *keycap = layer->keycaps; (*keycap)[0] != '\0'; ++keycap) {
+        if (strcmp(*keycap, "\n") == 0) {
+            row_starts[++row] = key;
+            units = 0;
+            continue;
+        }
+        units += get_key_width(layer->attributes[key]);
+        unit_ends[key++] = units;
+    }
+    row_starts[num_rows] = key;
+
+    geometry->num_rows = num_rows;
+    geometry->row_starts = row_starts;
+    geometry->unit_ends = unit_ends;
+    return true;
+}
+
+static const sq2lv_layer_geometry_t *get_layout_geometries(sq2lv_layout_id_t layout_id) {
+    if (!layout_geometries) {
+        layout_geometries = calloc(sq2lv_num_layouts, sizeof(sq2lv_layer_geometry_t *));
+        if (!layout_geometries) {
+            return NULL;
+        }
+    }
+
+    if (!layout_geometries[layout_id]) {
+        /* Layers whose geometry cannot be computed are left empty so that callers fall back to LVGL's own lookup */
+        layout_geometries[layout_id] = calloc(sq2lv_layouts[layout_id].num_layers, sizeof(sq2lv_layer_geometry_t));
+        if (!layout_geometries[layout_id]) {
+            return NULL;
+        }
+        for (int i = 0; i < sq2lv_layouts[layout_id].num_layers; ++i) {
+            compute_layer_geometry(&(sq2lv_layouts[layout_id].layers[i]), &(layout_geometries[layout_id][i]));
+        }
+    }
+
+    return layout_geometries[layout_id];
+}
+
 
 /**
  * Public functions
@@ -141,18 +250,36 @@ sq2lv_layout_id_t sq2lv_find_layout_with_short_name(const char *name) {
     return SQ2LV_LAYOUT_NONE;
 }
 
+bool sq2lv_parse_layout_option(const char *value, void *result) {
+    sq2lv_layout_id_t id = sq2lv_find_layout_with_short_name(value);
+    if (id == SQ2LV_LAYOUT_NONE) {
+        return false;
+    }
+    *(sq2lv_layout_id_t *)result = id;
+    return true;
+}
+
 void sq2lv_switch_layout(lv_obj_t *keyboard, sq2lv_layout_id_t layout_id) {
     if (layout_id < 0 || layout_id >= sq2lv_num_layouts) {
         return;
     }
 
-    /* Assign layers */
-    for (int i = 0; i < sq2lv_layouts[layout_id].num_layers; ++i) {
-        lv_keyboard_set_map(keyboard, layer_index_to_keyboard_mode(i),
-            (const char **)sq2lv_layouts[layout_id].layers[i].keycaps,
-            sq2lv_layouts[layout_id].layers[i].attributes);
+    /* Assign layers. Every assignment makes LVGL re-parse and lay out the displayed map, so skip
+     * layers whose arrays are already in place (e.g. when re-applying the current layout or when
+     * layouts share identical layers). */
+    for (int i = 0; i < sq2lv_layouts[layout_id].num_layers && i < MAX_LAYERS; ++i) {
+        const sq2lv_layer_t *layer = &(sq2lv_layouts[layout_id].layers[i]);
+        if (assigned_keycaps[i] == layer->keycaps && assigned_attributes[i] == layer->attributes) {
+            continue;
+        }
+        lv_keyboard_set_map(keyboard, layer_index_to_keyboard_mode(i), (const char **)layer->keycaps, layer->attributes);
+        assigned_keycaps[i] = layer->keycaps;
+        assigned_attributes[i] = layer->attributes;
     }
 
+    /* Build the layout's geometry now rather than on the first touch */
+    get_layout_geometries(layout_id);
+
     /* Switch to default layer if current layer doesn't exist in new layout */
     int layer_index = get_layer_index(keyboard);
     if (layer_index < 0 || layer_index >= sq2lv_layouts[layout_id].num_layers) {
@@ -162,6 +289,24 @@ void sq2lv_switch_layout(lv_obj_t *keyboard, sq2lv_layout_id_t layout_id) {
     current_layout_id = layout_id;
 }
 
+const sq2lv_layer_geometry_t *sq2lv_get_layer_geometry(lv_obj_t *keyboard) {
+    if (current_layout_id < 0 || current_layout_id >= sq2lv_num_layouts) {
+        return NULL;
+    }
+
+    int layer_index = get_layer_index(keyboard);
+    if (layer_index < 0 || layer_index >= sq2lv_layouts[current_layout_id].num_layers) {
+        return NULL;
+    }
+
+    const sq2lv_layer_geometry_t *geometries = get_layout_geometries(current_layout_id);
+    if (!geometries || geometries[layer_index].num_rows == 0) {
+        return NULL;
+    }
+
+    return &(geometries[layer_index]);
+}
+
 bool sq2lv_is_layer_switcher(lv_obj_t *keyboard, uint16_t btn_id) {
     return get_destination_layer_index_for_layer_switcher(keyboard, btn_id) >= 0;
 }
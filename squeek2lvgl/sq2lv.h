@@ -14,6 +14,16 @@
 #define SQ2LV_CTRL_MOD_ACTIVE   (LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKABLE)
 #define SQ2LV_CTRL_MOD_INACTIVE (LV_BUTTONMATRIX_CTRL_CLICK_TRIG | LV_BUTTONMATRIX_CTRL_CHECKABLE | LV_BUTTONMATRIX_CTRL_CHECKED)
 
+/* Precomputed geometry of a layer, in key width units */
+typedef struct {
+    /* Number of rows, including empty ones */
+    int num_rows;
+    /* Button index of the first key in each row, followed by the total number of keys */
+    uint16_t *row_starts;
+    /* Cumulative width of the keys in a row up to and including each key */
+    uint16_t *unit_ends;
+} sq2lv_layer_geometry_t;
+
 /**
  * Find the first layout with a given short name.
  *
@@ -22,6 +32,15 @@
  */
 sq2lv_layout_id_t sq2lv_find_layout_with_short_name(const char *name);
 
+/**
+ * Parse a keyboard layout option value.
+ *
+ * @param value layout short name
+ * @param result pointer to a sq2lv_layout_id_t to write the layout into if parsing is successful
+ * @return true on success, false otherwise
+ */
+bool sq2lv_parse_layout_option(const char *value, void *result);
+
 /**
  * Apply a layout to a keyboard.
  *
@@ -30,6 +49,14 @@ sq2lv_layout_id_t sq2lv_find_layout_with_short_name(const char *name);
  */
 void sq2lv_switch_layout(lv_obj_t *keyboard, sq2lv_layout_id_t layout_id);
 
+/**
+ * Get the precomputed geometry of the keyboard's current layer.
+ *
+ * @param keyboard keyboard widget
+ * @return pointer to the layer geometry or NULL if it isn't available
+ */
+const sq2lv_layer_geometry_t *sq2lv_get_layer_geometry(lv_obj_t *keyboard);
+
 /**
  * Check if a key acts as a layer switcher in the current layer.
  *
@@ -0,0 +1,459 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+/**
+ * Consistency check and microbenchmark for the sq2lv runtime and a set of generated layouts.
+ *
+ * Build this together with sq2lv.c and an application's sq2lv_layouts.c. The tables are checked first and
+ * the benchmarks only run if they are consistent. Exits with a non-zero code on inconsistencies.
+ */
+
+
+#include "sq2lv.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+/**
+ * Defines
+ */
+
+/* Default number of times each benchmark is repeated */
+#define DEFAULT_ITERATIONS 1000
+
+/* Highest valid Linux key code, see linux/input-event-codes.h */
+#define MAX_SCANCODE 0x2ff
+
+
+/**
+ * Static variables
+ */
+
+/* LVGL keyboard modes in the order in which sq2lv maps layers onto them */
+static const lv_keyboard_mode_t layer_modes[] = {
+    LV_KEYBOARD_MODE_TEXT_LOWER,
+    LV_KEYBOARD_MODE_TEXT_UPPER,
+    LV_KEYBOARD_MODE_SPECIAL,
+    LV_KEYBOARD_MODE_NUMBER,
+    LV_KEYBOARD_MODE_USER_1,
+    LV_KEYBOARD_MODE_USER_2,
+    LV_KEYBOARD_MODE_USER_3,
+    LV_KEYBOARD_MODE_USER_4
+};
+
+#define MAX_LAYERS ((int)(sizeof(layer_modes) / sizeof(layer_modes[0])))
+
+static int num_errors = 0;
+
+/* Accumulates lookup results so that the compiler cannot drop the benchmarked calls */
+static volatile long sink = 0;
+
+
+/**
+ * Static prototypes
+ */
+
+/**
+ * Report an inconsistency in a layer.
+ *
+ * @param layout_id layout ID
+ * @param layer_index layer index
+ * @param format printf format string of the message
+ */
+static void fail(sq2lv_layout_id_t layout_id, int layer_index, const char *format, ...) __attribute__((format(printf, 3, 4)));
+
+/**
+ * Get the current time of the monotonic clock.
+ *
+ * @return time in nanoseconds
+ */
+static long long now_ns(void);
+
+/**
+ * Print the result of a benchmark.
+ *
+ * @param name name of the benchmark
+ * @param num_calls number of measured calls
+ * @param elapsed_ns total time spent in the measured calls
+ */
+static void report(const char *name, long long num_calls, long long elapsed_ns);
+
+/**
+ * Show a layer of the current layout on a keyboard.
+ *
+ * @param keyboard keyboard widget
+ * @param layer_index layer index
+ */
+static void show_layer(lv_obj_t *keyboard, int layer_index);
+
+/**
+ * Count the keys in a layer's keycap map.
+ *
+ * @param layer layer to inspect
+ * @return number of keys, excluding row separators
+ */
+static int count_keys(const sq2lv_layer_t *layer);
+
+/**
+ * Check the generated tables of a layer.
+ *
+ * @param layout_id layout ID
+ * @param layer_index layer index
+ */
+static void check_layer_tables(sq2lv_layout_id_t layout_id, int layer_index);
+
+/**
+ * Check that the runtime lookups agree with the generated tables of a layer.
+ *
+ * @param keyboard keyboard widget with the layer's layout applied
+ * @param layout_id layout ID
+ * @param layer_index layer index
+ */
+static void check_layer_lookups(lv_obj_t *keyboard, sq2lv_layout_id_t layout_id, int layer_index);
+
+/**
+ * Check all layouts.
+ *
+ * @param keyboard keyboard widget to apply the layouts to
+ */
+static void check_layouts(lv_obj_t *keyboard);
+
+/**
+ * Benchmark the per-key lookups over every key of every layer.
+ *
+ * @param keyboard keyboard widget
+ * @param iterations number of repetitions
+ */
+static void bench_key_lookups(lv_obj_t *keyboard, int iterations);
+
+/**
+ * Benchmark layer switches triggered by every key of every layer.
+ *
+ * @param keyboard keyboard widget
+ * @param iterations number of repetitions
+ */
+static void bench_switch_layer(lv_obj_t *keyboard, int iterations);
+
+/**
+ * Benchmark switching between layouts and re-applying the current layout.
+ *
+ * @param keyboard keyboard widget
+ * @param iterations number of repetitions
+ */
+static void bench_switch_layout(lv_obj_t *keyboard, int iterations);
+
+/**
+ * Benchmark finding every layout and a missing one by short name.
+ *
+ * @param iterations number of repetitions
+ */
+static void bench_find_layout(int iterations);
+
+
+/**
+ * Static functions
+ */
+
+static void fail(sq2lv_layout_id_t layout_id, int layer_index, const char *format, ...) {
+    fprintf(stderr, "Layout %s, layer %d: ", sq2lv_layouts[layout_id].short_name, layer_index);
+    va_list args;
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+    fprintf(stderr, "\n");
+    ++num_errors;
+}
+
+static long long now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void report(const char *name, long long num_calls, long long elapsed_ns) {
+    printf("%-36s %12lld calls %10.1f ns/call\n", name, num_calls,
+        num_calls > 0 ? (double)elapsed_ns / num_calls : 0.0);
+}
+
+static void show_layer(lv_obj_t *keyboard, int layer_index) {
+    lv_keyboard_set_mode(keyboard, layer_modes[layer_index]);
+}
+
+static int count_keys(const sq2lv_layer_t *layer) {
+    int num_keys = 0;
+    for (const char * const *keycap = layer->keycaps; (*keycap)[0] != '\0'; ++keycap) {
+        if (strcmp(*keycap, "\n") != 0) {
+            ++num_keys;
+        }
+    }
+    return num_keys;
+}
+
+static void check_layer_tables(sq2lv_layout_id_t layout_id, int layer_index) {
+    const sq2lv_layout_t *layout = &(sq2lv_layouts[layout_id]);
+    const sq2lv_layer_t *layer = &(layout->layers[layer_index]);
+
+    int num_keys = count_keys(layer);
+    if (num_keys != layer->num_keys) {
+        fail(layout_id, layer_index, "keycap map has %d keys but num_keys is %d", num_keys, layer->num_keys);
+    }
+
+    for (int i = 0; i < layer->num_modifiers; ++i) {
+        if (layer->modifier_idxs[i] < 0 || layer->modifier_idxs[i] >= layer->num_keys) {
+            fail(layout_id, layer_index, "modifier %d refers to key %d which is out of range",
+                i, layer->modifier_idxs[i]);
+        }
+    }
+
+    for (int i = 0; i < layer->num_switchers; ++i) {
+        if (layer->switcher_idxs[i] >= layer->num_keys) {
+            fail(layout_id, layer_index, "switcher %d refers to key %d which is out of range",
+                i, layer->switcher_idxs[i]);
+        }
+        if (layer->switcher_dests[i] >= layout->num_layers) {
+            fail(layout_id, layer_index, "switcher %d leads to layer %d which is out of range",
+                i, layer->switcher_dests[i]);
+        }
+    }
+
+#if SQ2LV_SCANCODES_ENABLED
+    for (int i = 0; i < layer->num_keys; ++i) {
+        if (layer->scancode_nums[i] == 0) {
+            continue;
+        }
+        int start = layer->scancode_idxs[i];
+        int end = start + layer->scancode_nums[i];
+        if (start < 0 || end > layer->num_scancodes) {
+            fail(layout_id, layer_index, "scancodes %d to %d of key %d exceed the %d scancodes of the layer",
+                start, end - 1, i, layer->num_scancodes);
+            continue;
+        }
+        for (int j = start; j < end; ++j) {
+            if (layer->scancodes[j] <= 0 || layer->scancodes[j] > MAX_SCANCODE) {
+                fail(layout_id, layer_index, "key %d has invalid scancode %d", i, layer->scancodes[j]);
+            }
+        }
+    }
+#endif /* SQ2LV_SCANCODES_ENABLED */
+}
+
+static void check_layer_lookups(lv_obj_t *keyboard, sq2lv_layout_id_t layout_id, int layer_index) {
+    const sq2lv_layer_t *layer = &(sq2lv_layouts[layout_id].layers[layer_index]);
+    show_layer(keyboard, layer_index);
+
+    const sq2lv_layer_geometry_t *geometry = sq2lv_get_layer_geometry(keyboard);
+    if (!geometry) {
+        fail(layout_id, layer_index, "no geometry available");
+    } else if (geometry->row_starts[geometry->num_rows] != layer->num_keys) {
+        fail(layout_id, layer_index, "geometry covers %d keys but num_keys is %d",
+            geometry->row_starts[geometry->num_rows], layer->num_keys);
+    }
+
+    int num_modifiers = 0;
+    int num_switchers = 0;
+    for (int i = 0; i < layer->num_keys; ++i) {
+        num_modifiers += sq2lv_is_modifier(keyboard, i);
+        num_switchers += sq2lv_is_layer_switcher(keyboard, i);
+    }
+    if (num_modifiers != layer->num_modifiers) {
+        fail(layout_id, layer_index, "%d keys are reported as modifiers but the layer has %d",
+            num_modifiers, layer->num_modifiers);
+    }
+    if (num_switchers != layer->num_switchers) {
+        fail(layout_id, layer_index, "%d keys are reported as layer switchers but the layer has %d",
+            num_switchers, layer->num_switchers);
+    }
+
+    for (int i = 0; i < layer->num_switchers; ++i) {
+        show_layer(keyboard, layer_index);
+        if (!sq2lv_switch_layer(keyboard, layer->switcher_idxs[i])) {
+            fail(layout_id, layer_index, "switcher %d does not switch layers", i);
+        } else if (lv_keyboard_get_mode(keyboard) != layer_modes[layer->switcher_dests[i]]) {
+            fail(layout_id, layer_index, "switcher %d does not lead to layer %d", i, layer->switcher_dests[i]);
+        }
+    }
+}
+
+static void check_layouts(lv_obj_t *keyboard) {
+    if (sq2lv_num_layouts <= 0) {
+        fprintf(stderr, "No layouts found\n");
+        ++num_errors;
+        return;
+    }
+
+    for (int i = 0; i < sq2lv_num_layouts; ++i) {
+        const sq2lv_layout_t *layout = &(sq2lv_layouts[i]);
+
+        if (sq2lv_find_layout_with_short_name(layout->short_name) != i) {
+            fail(i, 0, "short name is shared with an earlier layout");
+        }
+        if (layout->num_layers <= 0 || layout->num_layers > MAX_LAYERS) {
+            fail(i, 0, "layout has %d layers but between 1 and %d are supported", layout->num_layers, MAX_LAYERS);
+            continue;
+        }
+
+        int num_errors_before = num_errors;
+        for (int j = 0; j < layout->num_layers; ++j) {
+            check_layer_tables(i, j);
+        }
+        /* Out of range indexes would make the runtime lookups read past the tables */
+        if (num_errors > num_errors_before) {
+            continue;
+        }
+
+        sq2lv_switch_layout(keyboard, i);
+        for (int j = 0; j < layout->num_layers; ++j) {
+            check_layer_lookups(keyboard, i, j);
+        }
+    }
+}
+
+static void bench_key_lookups(lv_obj_t *keyboard, int iterations) {
+    long long num_calls = 0;
+    long long elapsed_modifier = 0;
+    long long elapsed_switcher = 0;
+#if SQ2LV_SCANCODES_ENABLED
+    long long elapsed_scancodes = 0;
+#endif /* SQ2LV_SCANCODES_ENABLED */
+
+    for (int i = 0; i < sq2lv_num_layouts; ++i) {
+        sq2lv_switch_layout(keyboard, i);
+        for (int j = 0; j < sq2lv_layouts[i].num_layers; ++j) {
+            show_layer(keyboard, j);
+            int num_keys = sq2lv_layouts[i].layers[j].num_keys;
+            long long start;
+
+            start = now_ns();
+            for (int n = 0; n < iterations; ++n) {
+                for (int k = 0; k < num_keys; ++k) {
+                    sink += sq2lv_is_modifier(keyboard, k);
+                }
+            }
+            elapsed_modifier += now_ns() - start;
+
+            start = now_ns();
+            for (int n = 0; n < iterations; ++n) {
+                for (int k = 0; k < num_keys; ++k) {
+                    sink += sq2lv_is_layer_switcher(keyboard, k);
+                }
+            }
+            elapsed_switcher += now_ns() - start;
+
+#if SQ2LV_SCANCODES_ENABLED
+            start = now_ns();
+            for (int n = 0; n < iterations; ++n) {
+                for (int k = 0; k < num_keys; ++k) {
+                    int num_scancodes = 0;
+                    const int *scancodes = sq2lv_get_scancodes(keyboard, k, &num_scancodes);
+                    sink += num_scancodes > 0 ? scancodes[0] : 0;
+                }
+            }
+            elapsed_scancodes += now_ns() - start;
+#endif /* SQ2LV_SCANCODES_ENABLED */
+
+            num_calls += (long long)iterations * num_keys;
+        }
+    }
+
+    report("sq2lv_is_modifier", num_calls, elapsed_modifier);
+    report("sq2lv_is_layer_switcher", num_calls, elapsed_switcher);
+#if SQ2LV_SCANCODES_ENABLED
+    report("sq2lv_get_scancodes", num_calls, elapsed_scancodes);
+#endif /* SQ2LV_SCANCODES_ENABLED */
+}
+
+static void bench_switch_layer(lv_obj_t *keyboard, int iterations) {
+    long long num_calls = 0;
+    long long elapsed = 0;
+
+    for (int i = 0; i < sq2lv_num_layouts; ++i) {
+        sq2lv_switch_layout(keyboard, i);
+        for (int j = 0; j < sq2lv_layouts[i].num_layers; ++j) {
+            int num_keys = sq2lv_layouts[i].layers[j].num_keys;
+            for (int n = 0; n < iterations; ++n) {
+                for (int k = 0; k < num_keys; ++k) {
+                    /* Switchers leave the layer, so restore it outside of the measurement */
+                    show_layer(keyboard, j);
+                    long long start = now_ns();
+                    sink += sq2lv_switch_layer(keyboard, k);
+                    elapsed += now_ns() - start;
+                }
+            }
+            num_calls += (long long)iterations * num_keys;
+        }
+    }
+
+    report("sq2lv_switch_layer", num_calls, elapsed);
+}
+
+static void bench_switch_layout(lv_obj_t *keyboard, int iterations) {
+    long long elapsed_other = 0;
+    long long elapsed_same = 0;
+
+    for (int n = 0; n < iterations; ++n) {
+        for (int i = 0; i < sq2lv_num_layouts; ++i) {
+            long long start = now_ns();
+            sq2lv_switch_layout(keyboard, i);
+            elapsed_other += now_ns() - start;
+
+            start = now_ns();
+            sq2lv_switch_layout(keyboard, i);
+            elapsed_same += now_ns() - start;
+        }
+    }
+
+    report("sq2lv_switch_layout (other layout)", (long long)iterations * sq2lv_num_layouts, elapsed_other);
+    report("sq2lv_switch_layout (same layout)", (long long)iterations * sq2lv_num_layouts, elapsed_same);
+}
+
+static void bench_find_layout(int iterations) {
+    long long start = now_ns();
+    for (int n = 0; n < iterations; ++n) {
+        for (int i = 0; i < sq2lv_num_layouts; ++i) {
+            sink += sq2lv_find_layout_with_short_name(sq2lv_layouts[i].short_name);
+        }
+        sink += sq2lv_find_layout_with_short_name("missing");
+    }
+    long long elapsed = now_ns() - start;
+
+    report("sq2lv_find_layout_with_short_name", (long long)iterations * (sq2lv_num_layouts + 1), elapsed);
+}
+
+
+/**
+ * Main
+ */
+
+int main(int argc, char *argv[]) {
+    int iterations = DEFAULT_ITERATIONS;
+    if (argc > 2 || (argc == 2 && (iterations = atoi(argv[1])) <= 0)) {
+        fprintf(stderr, "Usage: %s [ITERATIONS]\n", argv[0]);
+        return 2;
+    }
+
+    /* The keyboard widget needs a screen but nothing is ever rendered */
+    lv_init();
+    lv_display_create(800, 480);
+    lv_obj_t *keyboard = lv_keyboard_create(lv_screen_active());
+
+    check_layouts(keyboard);
+    if (num_errors > 0) {
+        fprintf(stderr, "Found %d inconsistencies in %d layouts\n", num_errors, sq2lv_num_layouts);
+        return 1;
+    }
+    printf("Checked %d layouts\n", sq2lv_num_layouts);
+
+    bench_key_lookups(keyboard, iterations);
+    bench_switch_layer(keyboard, iterations);
+    bench_switch_layout(keyboard, iterations);
+    bench_find_layout(iterations);
+
+    return 0;
+}
@@ -6,8 +6,10 @@
 
 import argparse
 from typing import Set
-import git
+import hashlib
+import json
 import os
+import pickle
 import sys
 import tempfile
 import yaml
@@ -65,10 +67,19 @@ def parse_arguments():
                         + 'generate scancode tables (only works for US layout currently)')
     parser.add_argument('--output', dest='output', type=str, required=True, help='output directory for generated '
                         + 'files')
+    parser.add_argument('--squeekboard-dir', dest='squeekboard_dir', type=str, required=False, help='path to a '
+                        + 'local squeekboard checkout to read layouts from instead of cloning the repository')
+    parser.add_argument('--cache-dir', dest='cache_dir', type=str, required=False, help='directory for caching '
+                        + 'parsed layouts. If the inputs have not changed since the last run, the output files '
+                        + 'are left untouched.')
     args = parser.parse_args()
 
     if not args.output or not os.path.isdir(args.output):
         die('Error: no valid output directory specified')
+    if args.squeekboard_dir and not os.path.isdir(os.path.join(args.squeekboard_dir, rel_layouts_dir)):
+        die(f'Error: {args.squeekboard_dir} does not look like a squeekboard checkout')
+    if args.cache_dir:
+        os.makedirs(args.cache_dir, exist_ok=True)
 
     return args
 
@@ -78,24 +89,65 @@ def clone_squeekboard_repo(destination):
 
     destination -- directory path to clone to
     """
+    import git # Only needed when no local checkout is used
     git.Repo.clone_from(repository_url, destination, depth=1)
 
 
-def load_yaml(layouts_dir, rel_path):
-    """ Load a YAML file and return its dictionary representation.
-    
+def read_input_file(layouts_dir, rel_path):
+    """ Read a YAML file and return its raw content.
+
+    layouts_dir -- layouts root directory
     rel_path -- path of the YAML file relative to the layouts root directory
     """
     path = os.path.join(layouts_dir, rel_path)
     if not os.path.isfile(path):
         die(f'could not find input file {path}')
+    with open(path, 'rb') as fp:
+        return fp.read()
+
+
+def write_atomically(path, content):
+    """ Write content to a file via a temporary file so that readers never see partial content.
+
+    path -- path of the file to write
+    content -- bytes to write
+    """
+    tmp_path = f'{path}.tmp'
+    with open(tmp_path, 'wb') as fp:
+        fp.write(content)
+    os.replace(tmp_path, path)
+
+
+def load_yaml(layouts_dir, rel_path, cache_dir):
+    """ Load a YAML file and return its dictionary representation.
+    
+    layouts_dir -- layouts root directory
+    rel_path -- path of the YAML file relative to the layouts root directory
+    cache_dir -- directory for caching parsed files keyed by their content hash or None to disable caching
+    """
+    path = os.path.join(layouts_dir, rel_path)
+    content = read_input_file(layouts_dir, rel_path)
 
+    cache_path = None
     data = None
-    with open(path, 'r') as stream:
+
+    if cache_dir:
+        cache_path = os.path.join(cache_dir, hashlib.sha256(content).hexdigest() + '.pickle')
+        if os.path.isfile(cache_path):
+            try:
+                with open(cache_path, 'rb') as fp:
+                    data = pickle.load(fp)
+            except (OSError, pickle.UnpicklingError, EOFError):
+                warn(f'Ignoring unreadable cache file {cache_path}')
+
+    if data is None:
         try:
-            data = yaml.safe_load(stream)
+            data = yaml.safe_load(content)
         except yaml.YAMLError as exc:
             die(f'Could not load YAML file {path}: {exc}')
+        if cache_path and data:
+            write_atomically(cache_path, pickle.dumps(data))
+
     if not data:
         die(f'could not load input file {path}')
     if not 'views' in data:
@@ -104,16 +156,67 @@ def load_yaml(layouts_dir, rel_path):
     return data
 
 
+def compute_inputs_digest(layouts_dir):
+    """ Return a digest over everything that affects the generated files.
+
+    layouts_dir -- layouts root directory
+    """
+    digest = hashlib.sha256()
+    with open(os.path.abspath(__file__), 'rb') as fp:
+        digest.update(fp.read())
+    options = {k: v for k, v in vars(args).items() if k not in ['cache_dir', 'squeekboard_dir']}
+    digest.update(json.dumps(options, sort_keys=True).encode('utf-8'))
+    for file in args.input:
+        digest.update(hashlib.sha256(read_input_file(layouts_dir, file)).digest())
+    return digest.hexdigest()
+
+
+def get_stamp_path():
+    """ Return the path of the file recording the inputs digest of the last run for the output directory.
+    """
+    output_id = hashlib.sha256(os.path.abspath(args.output).encode('utf-8')).hexdigest()
+    return os.path.join(args.cache_dir, f'{output_id}.stamp')
+
+
+def is_output_up_to_date(inputs_digest):
+    """ Return True if the output files were generated from identical inputs before.
+
+    inputs_digest -- digest of the current inputs
+    """
+    for outfile in [outfile_c, outfile_h]:
+        if not os.path.isfile(os.path.join(args.output, outfile)):
+            return False
+    try:
+        with open(get_stamp_path(), 'r') as fp:
+            return fp.read().strip() == inputs_digest
+    except OSError:
+        return False
+
+
+def write_file_if_changed(path, content):
+    """ Write content to a file unless it already has the exact same content, so that build systems
+    don't rebuild dependents needlessly.
+
+    path -- path of the file to write
+    content -- string to write
+    """
+    encoded = content.encode('utf-8')
+    if os.path.isfile(path):
+        with open(path, 'rb') as fp:
+            if fp.read() == encoded:
+                return
+    with open(path, 'wb') as fp:
+        fp.write(encoded)
+
+
 def write_files(lines_c, lines_h):
     """Write accumulated output to C and header file, respectively.
 
     lines_c -- sequence of lines to write to C file
     lines_h -- sequence of lines to write to header
     """
-    with open(os.path.join(args.output, outfile_c), 'w') as fp:
-        fp.write('\n'.join(lines_c))
-    with open(os.path.join(args.output, outfile_h), 'w') as fp:
-        fp.write('\n'.join(lines_h))
+    write_file_if_changed(os.path.join(args.output, outfile_c), '\n'.join(lines_c))
+    write_file_if_changed(os.path.join(args.output, outfile_h), '\n'.join(lines_h))
 
 
 def comma_if_needed(sequence, idx):
@@ -137,6 +240,7 @@ class SourceFileBuilder(object):
         """Constructor.
         """
         self.lines = [] 
+        self.interned_arrays = {}
         self._add_header_comment()
 
     def add_line(self, line=None):
@@ -236,6 +340,45 @@ class SourceFileBuilder(object):
 
         return self
 
+    def add_interned_array(self, type, identifier, values, row_terminator, array_terminator):
+        """Add a static row-based C array followed by an empty line unless an array of the same type and
+        with identical elements was added before. Return the identifier under which the elements can be
+        referenced.
+
+        type -- variable type
+        identifier -- variable identifier to use if the array is added
+        values -- values per row as a list of lists,
+        row_terminator -- element to append to each row except the last
+        array_terminator -- element to append to the last row
+        """
+        elements = []
+        for i, values_in_row in enumerate(values):
+            elements += [f'{e}' for e in values_in_row]
+            if i < len(values) - 1 and row_terminator:
+                elements.append(row_terminator)
+            if i == len(values) - 1 and array_terminator:
+                elements.append(array_terminator)
+
+        key = (type, tuple(elements))
+        if key in self.interned_arrays:
+            return self.interned_arrays[key]
+
+        self.interned_arrays[key] = identifier
+        self.add_array(True, type, identifier, values, row_terminator, array_terminator)
+        self.add_line()
+        return identifier
+
+    def add_interned_flat_array(self, type, identifier, values, array_terminator):
+        """Add a static flat C array followed by an empty line unless an identical array was added before.
+        Return the identifier under which the elements can be referenced.
+
+        type -- variable type
+        identifier -- variable identifier to use if the array is added
+        values -- list of values,
+        array_terminator -- element to append after the last element
+        """
+        return self.add_interned_array(type, identifier, [values], '', array_terminator)
+
     def add_flat_array(self, static, type, identifier, values, array_terminator):
         """Add a flat C array and return the builder.
         
@@ -671,6 +814,21 @@ def get_keycaps_attrs_modifiers_switchers_scancodes(args, view_id, data_views, d
     return keycaps, attrs, modifier_idxs, switcher_idxs, switcher_dests, scancodes
 
 
+def check_range(values, minimum, maximum, description):
+    """Abort if any of the values lies outside of a range.
+
+    values -- list (rows) of list (values) or flat list of values
+    minimum -- smallest allowed value
+    maximum -- largest allowed value
+    description -- description of the values for use in error messages
+    """
+    for value in values:
+        if isinstance(value, list):
+            check_range(value, minimum, maximum, description)
+        elif value < minimum or value > maximum:
+            die(f'Value {value} of {description} is outside of the range [{minimum}, {maximum}]')
+
+
 def flatten_scancodes(scancodes):
     """Process a nested list of scancodes per row and key and return a flattened list of scancodes per row,
     a list of starting indexes and a list of scancode counts.
@@ -704,12 +862,14 @@ def flatten_scancodes(scancodes):
 
 
 ###
-# Main
+# Generation
 ##
 
-if __name__ == '__main__':
-    args = parse_arguments()
+def generate(layouts_dir):
+    """Generate the output files from the layouts in a squeekboard layouts directory.
 
+    layouts_dir -- layouts root directory
+    """
     c_builder = SourceFileBuilder()
     c_builder.add_include(outfile_h)
     c_builder.add_include('../squeek2lvgl/sq2lv.h')
@@ -730,113 +890,120 @@ if __name__ == '__main__':
     layouts = []
     unique_scancodes = {}
 
-    with tempfile.TemporaryDirectory() as tmp:
-        clone_squeekboard_repo(tmp)
+    for file, layout_name in zip(args.input, args.name):
+        layout_id, _ = os.path.splitext(file)
+        layout_identifier = layout_id_to_c_identifier(layout_id)
 
-        layouts_dir = os.path.join(tmp, rel_layouts_dir)
+        data = load_yaml(layouts_dir, file, args.cache_dir)
+        data_views = data['views']
+        data_buttons = data['buttons'] if 'buttons' in data else {}
 
-        for file, layout_name in zip(args.input, args.name):
-            layout_id, _ = os.path.splitext(file)
-            layout_identifier = layout_id_to_c_identifier(layout_id)
+        c_builder.add_section_comment(f'Layout: {layout_name} - generated from {layout_id}')
+        c_builder.add_line()
+        c_builder.add_line(f'static const char * const name_{layout_identifier} = "{layout_name}";')
+        c_builder.add_line(f'static const char * const short_name_{layout_identifier} = "{layout_id}";')
+        c_builder.add_line()
 
-            data = load_yaml(layouts_dir, file)
-            data_views = data['views']
-            data_buttons = data['buttons'] if 'buttons' in data else {}
+        layer_identifiers = []
+        layer_references = []
 
-            c_builder.add_section_comment(f'Layout: {layout_name} - generated from {layout_id}')
-            c_builder.add_line()
-            c_builder.add_line(f'static const char * const name_{layout_identifier} = "{layout_name}";')
-            c_builder.add_line(f'static const char * const short_name_{layout_identifier} = "{layout_id}";')
+        view_ids = [view_id for view_id in data_views if view_id_to_layer_name(view_id) != None]
+
+        for view_id in data_views:
+            layer_name = view_id_to_layer_name(view_id)
+            if not layer_name:
+                warn(f'Ignoring unknown view_id {view_id}')
+                continue
+
+            layer_identifier = f'{view_id_to_c_identifier(view_id)}_{layout_identifier}'
+            layer_identifiers.append(layer_identifier)
+
+            c_builder.add_subsection_comment(f'Layer: {layer_name} - generated from {view_id}')
             c_builder.add_line()
+ 
+            extra_top_row = None
+            if view_id == "base":
+                extra_top_row = args.extra_top_row_base
+            if view_id == "upper":
+                extra_top_row = args.extra_top_row_upper
+            if not extra_top_row and (args.extra_top_row_base or args.extra_top_row_upper):
+                extra_top_row = "<hidden>"
 
-            layer_identifiers = []
+            keycaps, attrs, modifier_idxs, switcher_idxs, switcher_dests, scancodes = get_keycaps_attrs_modifiers_switchers_scancodes(
+                args, view_id, data_views, data_buttons, extra_top_row)
 
-            view_ids = [view_id for view_id in data_views if view_id_to_layer_name(view_id) != None]
+            for dest in switcher_dests:
+                if dest not in view_ids:
+                    die(f'Unhandled layer switch destination {dest}')
+            switcher_dests = [view_ids.index(d) for d in switcher_dests if d in view_ids]
 
-            for view_id in data_views:
-                layer_name = view_id_to_layer_name(view_id)
-                if not layer_name:
-                    warn(f'Ignoring unknown view_id {view_id}')
-                    continue
+            references = {}
 
-                layer_identifier = f'{view_id_to_c_identifier(view_id)}_{layout_identifier}'
-                layer_identifiers.append(layer_identifier)
+            c_builder.add_line(f'static const int num_keys_{layer_identifier} = {sum([len(row) for row in keycaps])};')
+            c_builder.add_line()
+            references['keycaps'] = c_builder.add_interned_array('const char * const',
+                f'keycaps_{layer_identifier}', keycaps, '"\\n"', '""')
+            references['attributes'] = c_builder.add_interned_array('const lv_buttonmatrix_ctrl_t',
+                f'attributes_{layer_identifier}', attrs, '', '')
 
-                c_builder.add_subsection_comment(f'Layer: {layer_name} - generated from {view_id}')
-                c_builder.add_line()
- 
-                extra_top_row = None
-                if view_id == "base":
-                    extra_top_row = args.extra_top_row_base
-                if view_id == "upper":
-                    extra_top_row = args.extra_top_row_upper
-                if not extra_top_row and (args.extra_top_row_base or args.extra_top_row_upper):
-                    extra_top_row = "<hidden>"
-
-                keycaps, attrs, modifier_idxs, switcher_idxs, switcher_dests, scancodes = get_keycaps_attrs_modifiers_switchers_scancodes(
-                    args, view_id, data_views, data_buttons, extra_top_row)
-
-                for dest in switcher_dests:
-                    if dest not in view_ids:
-                        die(f'Unhandled layer switch destination {dest}')
-                switcher_dests = [view_ids.index(d) for d in switcher_dests if d in view_ids]
-
-                c_builder.add_line(f'static const int num_keys_{layer_identifier} = {sum([len(row) for row in keycaps])};')
-                c_builder.add_line()
-                c_builder.add_array(True, 'const char * const', f'keycaps_{layer_identifier}', keycaps, '"\\n"', '""')
-                c_builder.add_line()
-                c_builder.add_array(True, 'const lv_buttonmatrix_ctrl_t', f'attributes_{layer_identifier}', attrs, '', '')
-                c_builder.add_line()
+            c_builder.add_line(f'static const int num_modifiers_{layer_identifier} = {len(modifier_idxs)};')
+            c_builder.add_line()
+            references['modifier_idxs'] = c_builder.add_interned_flat_array('const int',
+                f'modifier_idxs_{layer_identifier}', modifier_idxs, '')
 
-                c_builder.add_line(f'static const int num_modifiers_{layer_identifier} = {len(modifier_idxs)};')
-                c_builder.add_line()
-                c_builder.add_flat_array(True, 'const int', f'modifier_idxs_{layer_identifier}', modifier_idxs, '')
-                c_builder.add_line()
+            check_range(switcher_idxs, 0, 0xffff, f'switcher_idxs_{layer_identifier}')
+            check_range(switcher_dests, 0, 0xffff, f'switcher_dests_{layer_identifier}')
 
-                c_builder.add_line(f'static const int num_switchers_{layer_identifier} = {len(switcher_idxs)};')
-                c_builder.add_line()
-                c_builder.add_flat_array(True, 'const int', f'switcher_idxs_{layer_identifier}', switcher_idxs, '')
-                c_builder.add_line()
-                c_builder.add_flat_array(True, 'const int', f'switcher_dests_{layer_identifier}', switcher_dests, '')
-                c_builder.add_line()
+            c_builder.add_line(f'static const int num_switchers_{layer_identifier} = {len(switcher_idxs)};')
+            c_builder.add_line()
+            references['switcher_idxs'] = c_builder.add_interned_flat_array('const uint16_t',
+                f'switcher_idxs_{layer_identifier}', switcher_idxs, '')
+            references['switcher_dests'] = c_builder.add_interned_flat_array('const uint16_t',
+                f'switcher_dests_{layer_identifier}', switcher_dests, '')
 
-                if args.generate_scancodes:
-                    scancodes_flat, scancode_idxs, scancode_nums = flatten_scancodes(scancodes)
+            if args.generate_scancodes:
+                scancodes_flat, scancode_idxs, scancode_nums = flatten_scancodes(scancodes)
 
-                    for scancodes_in_row in scancodes_flat:
-                        for scancode in scancodes_in_row:
-                            unique_scancodes[scancode] = True
+                for scancodes_in_row in scancodes_flat:
+                    for scancode in scancodes_in_row:
+                        unique_scancodes[scancode] = True
 
-                    c_builder.add_line(f'static const int num_scancodes_{layer_identifier} = {len(scancodes)};')
-                    c_builder.add_line()
-                    c_builder.add_array(True, 'const int', f'scancodes_{layer_identifier}', scancodes_flat, '', '')
-                    c_builder.add_line()
-                    c_builder.add_array(True, 'const int', f'scancode_idxs_{layer_identifier}', scancode_idxs, '', '')
-                    c_builder.add_line()
-                    c_builder.add_array(True, 'const int', f'scancode_nums_{layer_identifier}', scancode_nums, '', '')
-                    c_builder.add_line()
+                check_range(scancode_idxs, -1, 0x7fff, f'scancode_idxs_{layer_identifier}')
+                check_range(scancode_nums, 0, 0xffff, f'scancode_nums_{layer_identifier}')
 
-            c_builder.add_subsection_comment(f'Layer array')
-            c_builder.add_line()
-            c_builder.add_line(f'static const int num_layers_{layout_identifier} = {len(layer_identifiers)};')
-            c_builder.add_line()
-            c_builder.add_line(f'static const sq2lv_layer_t layers_{layout_identifier}[] = ' + '{')
-            for i, identifier in enumerate(layer_identifiers):
-                c_builder.add_line('    {')
-                fields = ['num_keys', 'keycaps', 'attributes', 'num_modifiers', 'modifier_idxs', 'num_switchers', 'switcher_idxs', 'switcher_dests']
-                if args.generate_scancodes:
-                    fields += ['num_scancodes', 'scancodes', 'scancode_idxs', 'scancode_nums']
-                for k, field in enumerate(fields):
-                    c_builder.add_line(f'        .{field} = {field}_{identifier}{comma_if_needed(fields, k)}')
-                c_builder.add_line('    }' + comma_if_needed(layer_identifiers, i))
-            c_builder.add_line('};')
-            c_builder.add_line()
+                c_builder.add_line(f'static const int num_scancodes_{layer_identifier} = {sum(len(row) for row in scancodes_flat)};')
+                c_builder.add_line()
+                references['scancodes'] = c_builder.add_interned_array('const int',
+                    f'scancodes_{layer_identifier}', scancodes_flat, '', '')
+                references['scancode_idxs'] = c_builder.add_interned_array('const int16_t',
+                    f'scancode_idxs_{layer_identifier}', scancode_idxs, '', '')
+                references['scancode_nums'] = c_builder.add_interned_array('const uint16_t',
+                    f'scancode_nums_{layer_identifier}', scancode_nums, '', '')
 
-            layouts.append({
-                'name': layout_name,
-                'short_name': layout_id,
-                'identifier': layout_identifier
-            })
+            layer_references.append(references)
+
+        c_builder.add_subsection_comment(f'Layer array')
+        c_builder.add_line()
+        c_builder.add_line(f'static const int num_layers_{layout_identifier} = {len(layer_identifiers)};')
+        c_builder.add_line()
+        c_builder.add_line(f'static const sq2lv_layer_t layers_{layout_identifier}[] = ' + '{')
+        for i, identifier in enumerate(layer_identifiers):
+            c_builder.add_line('    {')
+            fields = ['num_keys', 'keycaps', 'attributes', 'num_modifiers', 'modifier_idxs', 'num_switchers', 'switcher_idxs', 'switcher_dests']
+            if args.generate_scancodes:
+                fields += ['num_scancodes', 'scancodes', 'scancode_idxs', 'scancode_nums']
+            for k, field in enumerate(fields):
+                reference = layer_references[i].get(field, f'{field}_{identifier}')
+                c_builder.add_line(f'        .{field} = {reference}{comma_if_needed(fields, k)}')
+            c_builder.add_line('    }' + comma_if_needed(layer_identifiers, i))
+        c_builder.add_line('};')
+        c_builder.add_line()
+
+        layouts.append({
+            'name': layout_name,
+            'short_name': layout_id,
+            'identifier': layout_identifier
+        })
 
     h_builder.add_line('/* Layout IDs, values can be used as indexes into the sq2lv_layouts array */')
     h_builder.add_line('typedef enum {')
@@ -862,18 +1029,18 @@ if __name__ == '__main__':
     h_builder.add_line('    /* Number of buttons that trigger a layer switch */')
     h_builder.add_line('    const int num_switchers;')
     h_builder.add_line('    /* Button indexes that trigger a layer switch */')
-    h_builder.add_line('    const int * const switcher_idxs;')
+    h_builder.add_line('    const uint16_t * const switcher_idxs;')
     h_builder.add_line('    /* Indexes of layers to jump to when triggering layer switch buttons */')
-    h_builder.add_line('    const int * const switcher_dests;')
+    h_builder.add_line('    const uint16_t * const switcher_dests;')
     if args.generate_scancodes:
         h_builder.add_line('    /* Total number of scancodes */')
         h_builder.add_line('    const int num_scancodes;')
         h_builder.add_line('    /* Flat array of scancodes */')
         h_builder.add_line('    const int * const scancodes;')
         h_builder.add_line('    /* Start index in scancodes array for key cap */')
-        h_builder.add_line('    const int * const scancode_idxs;')
+        h_builder.add_line('    const int16_t * const scancode_idxs;')
         h_builder.add_line('    /* Number of scancodes for key cap */')
-        h_builder.add_line('    const int * const scancode_nums;')
+        h_builder.add_line('    const uint16_t * const scancode_nums;')
     h_builder.add_line('} sq2lv_layer_t;')
     h_builder.add_line()
 
@@ -948,4 +1115,36 @@ if __name__ == '__main__':
 
     h_builder.wrap_in_ifndef('SQ2LV_LAYOUTS_H')
 
-    write_files(c_builder.lines, h_builder.lines)
\ No newline at end of file
+    write_files(c_builder.lines, h_builder.lines)
+
+
+def generate_with_cache(layouts_dir):
+    """Generate the output files unless they are up to date according to the cache.
+
+    layouts_dir -- layouts root directory
+    """
+    if not args.cache_dir:
+        generate(layouts_dir)
+        return
+
+    inputs_digest = compute_inputs_digest(layouts_dir)
+    if is_output_up_to_date(inputs_digest):
+        return
+
+    generate(layouts_dir)
+    write_atomically(get_stamp_path(), inputs_digest.encode('utf-8'))
+
+
+###
+# Main
+##
+
+if __name__ == '__main__':
+    args = parse_arguments()
+
+    if args.squeekboard_dir:
+        generate_with_cache(os.path.join(args.squeekboard_dir, rel_layouts_dir))
+    else:
+        with tempfile.TemporaryDirectory() as tmp:
+            clone_squeekboard_repo(tmp)
+            generate_with_cache(os.path.join(tmp, rel_layouts_dir))
\ No newline at end of file
@@ -0,0 +1,541 @@
+#!/usr/bin/env python3
+
+# Copyright 2025 buffybox contributors
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+
+import argparse
+import json
+import os
+import re
+import statistics
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+
+###
+# Global constants
+
+# Skipped tests are reported with this exit code by meson
+exit_code_skip = 77
+
+# Unl0kr and f0rmz are run headless with a fixed geometry and a DPI that makes lv_dpx() an identity,
+# so that the positions of widgets can be computed from the theme. Typing scenarios check what the app
+# reports at the end, which catches positions that no longer match the app.
+hor_res = 800
+ver_res = 480
+dpi = 160
+
+# Input traces, see shared/indev.c
+trace_header = struct.Struct('=6sHii')
+trace_record = struct.Struct('=QBBhIii')
+trace_magic = b'BBXTRC'
+trace_version = 1
+
+(TRACE_DEVICE_ADDED, TRACE_DEVICE_REMOVED, TRACE_KEY_PRESSED, TRACE_KEY_RELEASED, TRACE_POINTER_MOTION,
+ TRACE_POINTER_MOTION_ABSOLUTE, TRACE_POINTER_PRESSED, TRACE_POINTER_RELEASED, TRACE_TOUCH_DOWN,
+ TRACE_TOUCH_MOTION, TRACE_TOUCH_UP) = range(11)
+
+BBX_INDEV_KEYBOARD = 2
+BBX_INDEV_TOUCHSCREEN = 5
+
+BBX_INDEV_CAP_KEYBOARD = 1 << 0
+BBX_INDEV_CAP_POINTER = 1 << 1
+
+# Device ids used in generated traces
+keyboard_id = 0
+touchscreen_id = 1
+
+# Evdev key codes, see linux/input-event-codes.h
+key_codes = {
+    **{ c: 2 + i for i, c in enumerate('1234567890') },
+    **{ c: 16 + i for i, c in enumerate('qwertyuiop') },
+    **{ c: 30 + i for i, c in enumerate('asdfghjkl') },
+    **{ c: 44 + i for i, c in enumerate('zxcvbnm') },
+    'enter': 28,
+    ' ': 57
+}
+
+# Rows of the keyboard layers used in the scenarios as (key, width) pairs, see sq2lv_layouts.c
+letter_rows = [
+    [(c, 2) for c in 'qwertyuiop'],
+    [(c, 2) for c in 'asdfghjkl'],
+    [('shift', 3)] + [(c, 2) for c in 'zxcvbnm'] + [('backspace', 3)]
+]
+
+layers = {
+    'us/lower': [[(c, 2) for c in '1234567890']] + letter_rows + [
+        [('123', 3), ('left', 2), (' ', 7), ('right', 2), ('.', 2), ('ok', 3)]
+    ],
+    'us/numbers': [
+        [('hidden', 2)],
+        [(c, 2) for c in '1234567890'],
+        [(c, 2) for c in '@#$%&-_+()'],
+        [('*/=', 3)] + [(c, 2) for c in ',"\':;!?'] + [('backspace', 3)],
+        [('ABC', 3), ('left', 2), (' ', 7), ('right', 2), ('.', 2), ('ok', 3)]
+    ],
+    'terminal/us/lower': [
+        [('ctrl', 3), ('alt', 3), ('up', 3), ('down', 3), ('left', 3), ('right', 3)]
+    ] + letter_rows + [
+        [('123', 3), (' ', 7), ('>_', 3), ('ok', 3)]
+    ]
+}
+
+# Geometry of the breezy-dark theme
+header_pad = 10
+header_gap = 10
+keyboard_pad = 10
+keyboard_gap = 10
+keyboard_border = 1
+# Line height of the 32px font plus the padding and border of the dropdown button
+header_button_size = 41 + 2 * 5 + 2 * 1
+dropdown_width = 90
+dropdown_item_height = 41
+
+# 64 characters that can be typed on the lowercase layer of both the regular and the terminal layout
+passphrase = ('thequickbrownfoxjumpsoverthelazydog' * 2)[:64]
+
+
+###
+# General helpers
+##
+
+def die(msg):
+    """Print an error message to STDERR and exit with a non-zero code.
+
+    msg -- message to output on STDERR
+    """
+    sys.stderr.write(msg if msg.endswith('\n') else msg + '\n')
+    sys.exit(1)
+
+
+def skip(msg):
+    """Print a message to STDERR and exit with the code that meson uses for skipped tests.
+
+    msg -- message to output on STDERR
+    """
+    sys.stderr.write(msg if msg.endswith('\n') else msg + '\n')
+    sys.exit(exit_code_skip)
+
+
+###
+# Input traces
+##
+
+class Trace:
+    """Builder for input traces that can be replayed with --replay-input."""
+
+    def __init__(self, hor_res, ver_res):
+        """Create an empty trace.
+
+        hor_res -- physical horizontal resolution of the display
+        ver_res -- physical vertical resolution of the display
+        """
+        self.hor_res = hor_res
+        self.ver_res = ver_res
+        self.time = 0
+        self.records = []
+        self.has_keyboard = False
+        self.typed = None
+
+    def add(self, type, device, slot=0, value=0, x=0, y=0):
+        """Append a record at the current time."""
+        self.records.append(trace_record.pack(self.time, type, device, slot, value, x, y))
+
+    def wait(self, ms):
+        """Advance the current time.
+
+        ms -- number of milliseconds to wait
+        """
+        self.time += ms * 1000
+
+    def add_keyboard(self):
+        """Connect a keyboard."""
+        self.has_keyboard = True
+        self.add(TRACE_DEVICE_ADDED, keyboard_id, value=BBX_INDEV_KEYBOARD | BBX_INDEV_CAP_KEYBOARD << 8)
+
+    def add_touchscreen(self):
+        """Connect a touchscreen."""
+        self.add(TRACE_DEVICE_ADDED, touchscreen_id, value=BBX_INDEV_TOUCHSCREEN | BBX_INDEV_CAP_POINTER << 8)
+
+    def key(self, name):
+        """Press and release a key on the keyboard.
+
+        name -- character or name of the key as in key_codes
+        """
+        self.add(TRACE_KEY_PRESSED, keyboard_id, value=key_codes[name])
+        self.wait(40)
+        self.add(TRACE_KEY_RELEASED, keyboard_id, value=key_codes[name])
+        self.wait(80)
+
+    def tap(self, point):
+        """Tap the touchscreen.
+
+        point -- physical (x, y) coordinates
+        """
+        x, y = (round(c) for c in point)
+        self.add(TRACE_TOUCH_DOWN, touchscreen_id, x=x, y=y)
+        self.wait(60)
+        self.add(TRACE_TOUCH_UP, touchscreen_id)
+        self.wait(100)
+
+    def write(self, path):
+        """Write the trace to a file.
+
+        path -- path of the file
+        """
+        with open(path, 'wb') as f:
+            f.write(trace_header.pack(trace_magic, trace_version, self.hor_res, self.ver_res))
+            f.write(b''.join(self.records))
+
+
+###
+# Geometry
+##
+
+def key_center(layer, key, area):
+    """Compute the center of a key on the on-screen keyboard.
+
+    layer -- name of the layer in layers
+    key -- name of the key
+    area -- (x, y, width, height) of the keyboard
+    """
+    rows = layers[layer]
+    x0, y0, width, height = area
+    inset = keyboard_pad + keyboard_border
+    content_width = width - 2 * inset
+    row_height = (height - 2 * inset - (len(rows) - 1) * keyboard_gap) / len(rows)
+
+    for r, row in enumerate(rows):
+        unit = (content_width - (len(row) - 1) * keyboard_gap) / sum(w for _, w in row)
+        x = x0 + inset
+        for name, w in row:
+            if name == key:
+                return (x + w * unit / 2, y0 + inset + r * (row_height + keyboard_gap) + row_height / 2)
+            x += w * unit + keyboard_gap
+
+    die(f'Key {key} is not part of layer {layer}')
+
+
+def osk_area():
+    """Get the (x, y, width, height) of the on-screen keyboard of unl0kr and f0rmz."""
+    height = int(ver_res / 2.5) if ver_res > hor_res else int(ver_res / 1.8)
+    return (0, ver_res - height, hor_res, height)
+
+
+def header_button_center(index):
+    """Compute the center of a button in the header of unl0kr and f0rmz.
+
+    index -- 0 for the theme toggle, 1 for the keyboard toggle
+    """
+    x = header_pad + index * (header_button_size + header_gap)
+    return (x + header_button_size / 2, header_pad + header_button_size / 2)
+
+
+def dropdown_center():
+    """Compute the center of the layout dropdown in the header of unl0kr and f0rmz."""
+    x = header_pad + 2 * (header_button_size + header_gap)
+    return (x + dropdown_width / 2, header_pad + header_button_size / 2)
+
+
+def dropdown_item_center(index):
+    """Compute the center of an item in the opened layout dropdown list.
+
+    index -- index of the item
+    """
+    x, _ = dropdown_center()
+    return (x, header_pad + header_button_size + (index + 0.5) * dropdown_item_height)
+
+
+def fbdev_resolution():
+    """Get the resolution of /dev/fb0 or None if it cannot be determined."""
+    try:
+        with open('/sys/class/graphics/fb0/virtual_size') as f:
+            width, height = f.read().strip().split(',')
+            return (int(width), int(height))
+    except (OSError, ValueError):
+        return None
+
+
+###
+# Scenarios
+##
+
+def scenario_startup(trace):
+    """Start up and render the first frame."""
+
+
+def scenario_typing_osk(trace):
+    """Type a passphrase on the on-screen keyboard and submit it."""
+    trace.add_touchscreen()
+    for c in passphrase:
+        trace.tap(key_center('us/lower', c, osk_area()))
+    trace.tap(key_center('us/lower', 'ok', osk_area()))
+    trace.typed = passphrase
+
+
+def scenario_typing_keyboard(trace):
+    """Type a passphrase on a hardware keyboard and submit it."""
+    if not trace.has_keyboard:
+        trace.add_keyboard()
+    for c in passphrase:
+        trace.key(c)
+    trace.key('enter')
+    trace.typed = passphrase
+
+
+def in_form(scenario):
+    """Run a scenario on the first page of f0rmz' form instead of the intro screen.
+
+    scenario -- function of the scenario
+    """
+    def wrapper(trace):
+        trace.add_keyboard()
+        trace.key('enter')
+        scenario(trace)
+    wrapper.__doc__ = scenario.__doc__
+    return wrapper
+
+
+def scenario_layer_switch(trace):
+    """Switch between the layers of the on-screen keyboard."""
+    trace.add_touchscreen()
+    for _ in range(8):
+        trace.tap(key_center('us/lower', 'shift', osk_area()))
+        trace.tap(key_center('us/lower', 'shift', osk_area()))
+        trace.tap(key_center('us/lower', '123', osk_area()))
+        trace.tap(key_center('us/numbers', 'ABC', osk_area()))
+
+
+def scenario_layout_switch(trace):
+    """Switch between keyboard layouts with the dropdown in the header."""
+    trace.add_touchscreen()
+    for _ in range(4):
+        trace.tap(dropdown_center())
+        trace.tap(dropdown_item_center(1))
+        trace.tap(dropdown_center())
+        trace.tap(dropdown_item_center(0))
+
+
+def scenario_theme_toggle(trace):
+    """Toggle between the default and the alternate theme."""
+    trace.add_touchscreen()
+    for _ in range(16):
+        trace.tap(header_button_center(0))
+
+
+def scenario_keyboard_toggle(trace):
+    """Hide and show the on-screen keyboard, letting its animation run to completion."""
+    trace.add_touchscreen()
+    for _ in range(8):
+        trace.tap(header_button_center(1))
+        trace.wait(600)
+
+
+def scenario_terminal_typing(trace):
+    """Type a passphrase on buffyboard's keyboard and delete it again."""
+    width, height = trace.hor_res, trace.ver_res
+    keyboard_height = height // 3 if height > width else height // 2
+    area = (0, height - keyboard_height, width, keyboard_height)
+
+    trace.add_touchscreen()
+    for c in passphrase:
+        trace.tap(key_center('terminal/us/lower', c, area))
+    for _ in passphrase:
+        trace.tap(key_center('terminal/us/lower', 'backspace', area))
+
+
+# Scenarios by app as (function, whether to replay as fast as possible)
+scenarios = {
+    'unl0kr': {
+        'startup': (scenario_startup, True),
+        'typing-osk': (scenario_typing_osk, True),
+        'typing-keyboard': (scenario_typing_keyboard, True),
+        'layer-switch': (scenario_layer_switch, True),
+        'layout-switch': (scenario_layout_switch, True),
+        'theme-toggle': (scenario_theme_toggle, True),
+        'keyboard-toggle': (scenario_keyboard_toggle, False)
+    },
+    'f0rmz': {
+        'startup': (scenario_startup, True),
+        'typing-osk': (in_form(scenario_typing_osk), True),
+        'typing-keyboard': (in_form(scenario_typing_keyboard), True),
+        'layer-switch': (in_form(scenario_layer_switch), True),
+        'theme-toggle': (in_form(scenario_theme_toggle), True),
+        'keyboard-toggle': (in_form(scenario_keyboard_toggle), False)
+    },
+    'buffyboard': {
+        'typing-osk': (scenario_terminal_typing, True)
+    }
+}
+
+
+###
+# Running
+##
+
+def write_config(app, bpp, work_dir):
+    """Write the config override and return the additional command line arguments for an app.
+
+    app -- name of the app
+    bpp -- bits per pixel to render with on the memory backend
+    work_dir -- directory for temporary files
+    """
+    config = os.path.join(work_dir, 'bench.conf')
+    with open(config, 'w') as f:
+        f.write('[theme]\ndefault=breezy-dark\n')
+        if app != 'buffyboard':
+            f.write(f'[general]\nbackend=memory\nmemory_bpp={bpp}\n')
+            # Keep the on-screen keyboard visible when leaving f0rmz' intro screen with a hardware keyboard
+            f.write('[keyboard]\nautohide=false\nlayout=us\n')
+            f.write('[hardware keyboard]\nlayout=us\n')
+        if app == 'f0rmz':
+            f.write('[intro]\ntitle=Benchmark\nbody=Benchmark\n')
+            f.write('[form.first]\ntype=text\nlabel=First\n')
+            f.write('[form.second]\ntype=password\nlabel=Second\n')
+
+    if app == 'buffyboard':
+        return ['-C', config, '--rotate=0', f'--dpi={dpi}']
+    args = ['-C', config, f'--geometry={hor_res}x{ver_res}', f'--dpi={dpi}']
+    if app == 'f0rmz':
+        # Stream the first field to STDOUT once it is submitted
+        args += ['--output-fd=1', '--output-format=nul']
+    return args
+
+
+def expected_output(app, typed):
+    """Get what an app writes to STDOUT after a string was typed and submitted.
+
+    app -- name of the app
+    typed -- submitted string
+    """
+    if app == 'unl0kr':
+        return typed + '\n'
+    if app == 'f0rmz':
+        return f'first={typed}\0'
+    return None
+
+
+def run_once(binary, args, log, expected):
+    """Run an app once and return its metrics.
+
+    binary -- path of the app's executable
+    args -- command line arguments
+    log -- path of the file to write the app's output to, STDOUT goes to the same path with .out appended
+    expected -- what the app must write to STDOUT or None to not check it
+    """
+    with open(log, 'w') as f, open(log + '.out', 'wb') as out:
+        start = time.monotonic()
+        proc = subprocess.Popen([binary, '-v'] + args, stdin=subprocess.DEVNULL, stdout=out, stderr=f)
+        _, status, usage = os.wait4(proc.pid, 0)
+        wall_time = time.monotonic() - start
+        proc.returncode = os.waitstatus_to_exitcode(status)
+
+    with open(log) as f:
+        output = f.read()
+    with open(log + '.out', 'rb') as f:
+        stdout = f.read().decode(errors='replace')
+
+    if proc.returncode != 0:
+        die(f'{binary} exited with code {proc.returncode}:\n{output}')
+
+    if expected is not None and stdout != expected:
+        die(f'{binary} reported {stdout!r} instead of {expected!r}, the scenario\'s key positions probably '
+            f'don\'t match the app\'s layout any more:\n{output}')
+
+    match = re.search(r'Memory display statistics: (\d+) frames, (\d+) pixels', output)
+    return {
+        'wall_time_s': wall_time,
+        'cpu_time_s': usage.ru_utime + usage.ru_stime,
+        'frames': int(match.group(1)) if match else None,
+        'pixels_flushed': int(match.group(2)) if match else None,
+        'peak_rss_kib': usage.ru_maxrss
+    }
+
+
+def median(samples, key):
+    """Get the median of a metric over several runs or None if the metric is not available.
+
+    samples -- metrics of the runs
+    key -- name of the metric
+    """
+    values = [s[key] for s in samples if s[key] is not None]
+    return statistics.median(values) if values else None
+
+
+def get_commit():
+    """Get a description of the checked out commit or None if it cannot be determined."""
+    try:
+        return subprocess.run(['git', 'describe', '--always', '--dirty'], capture_output=True, text=True,
+            check=True, cwd=os.path.dirname(os.path.abspath(__file__))).stdout.strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+###
+# Main
+##
+
+def main():
+    parser = argparse.ArgumentParser(description='Run a buffybox app through a scripted input scenario and report performance metrics as JSON.')
+    parser.add_argument('--app', required=True, choices=scenarios.keys(), help='app to run')
+    parser.add_argument('--binary', required=True, help='path of the app\'s executable')
+    parser.add_argument('--scenario', required=True, help='scenario to run')
+    parser.add_argument('--bpp', type=int, choices=[16, 32], default=32,
+                        help='bits per pixel to render unl0kr and f0rmz with (default: 32)')
+    parser.add_argument('--runs', type=int, default=3, help='number of runs to take the median over (default: 3)')
+    parser.add_argument('--output', help='path of a file to write the results to in addition to STDOUT')
+    args = parser.parse_args()
+
+    if args.scenario not in scenarios[args.app]:
+        die(f'Unknown scenario {args.scenario} for {args.app}, available: {", ".join(scenarios[args.app])}')
+    function, is_fast = scenarios[args.app][args.scenario]
+
+    if args.app == 'buffyboard':
+        # Buffyboard types into the active virtual terminal and needs real devices
+        if os.environ.get('BBX_BENCH_BUFFYBOARD') != '1':
+            skip('Set BBX_BENCH_BUFFYBOARD=1 to benchmark buffyboard on the active virtual terminal')
+        if not os.access('/dev/uinput', os.W_OK) or not os.access('/dev/fb0', os.W_OK):
+            skip('Buffyboard needs write access to /dev/uinput and /dev/fb0')
+        resolution = fbdev_resolution()
+        if not resolution:
+            skip('Could not determine the resolution of /dev/fb0')
+        trace = Trace(*resolution)
+    else:
+        trace = Trace(hor_res, ver_res)
+
+    function(trace)
+
+    with tempfile.TemporaryDirectory() as work_dir:
+        trace_path = os.path.join(work_dir, 'trace')
+        trace.write(trace_path)
+
+        app_args = write_config(args.app, args.bpp, work_dir) + [f'--replay-input={trace_path}']
+        if is_fast:
+            app_args.append('--replay-fast')
+
+        expected = expected_output(args.app, trace.typed) if trace.typed is not None else None
+        samples = [run_once(args.binary, app_args, os.path.join(work_dir, 'log'), expected) for _ in range(args.runs)]
+
+    results = {
+        'app': args.app,
+        'scenario': args.scenario,
+        'bpp': args.bpp if args.app != 'buffyboard' else None,
+        'commit': get_commit(),
+        'runs': args.runs,
+        **{ key: median(samples, key) for key in samples[0] },
+        'samples': samples
+    }
+
+    output = json.dumps(results, indent=2)
+    print(output)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(output + '\n')
+
+
+if __name__ == '__main__':
+    main()
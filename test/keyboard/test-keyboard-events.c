@@ -0,0 +1,212 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/**
+ * Drives the on-screen keyboard with a scripted pointer on a headless display and checks that taps and slides
+ * across keys report exactly one key, the same as LVGL's own button matrix.
+ */
+
+#include "shared/keyboard.h"
+#include "shared/theme.h"
+#include "shared/themes.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define HOR_RES 800
+#define VER_RES 480
+
+/* Interval between pointer reads in milliseconds, short enough to never trigger a long press */
+#define STEP_MS 10
+
+/**
+ * Static variables
+ */
+
+static uint8_t draw_buffer[HOR_RES * VER_RES / 10 * 4];
+
+static lv_point_t pointer_point;
+static lv_indev_state_t pointer_state = LV_INDEV_STATE_RELEASED;
+
+static int num_value_changed = 0;
+
+/**
+ * Static prototypes
+ */
+
+/**
+ * Flush callback of the headless display.
+ *
+ * @param disp display
+ * @param area rendered area
+ * @param px_map render buffer
+ */
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
+
+/**
+ * Read callback of the scripted pointer.
+ *
+ * @param indev input device
+ * @param data data to fill in
+ */
+static void read_cb(lv_indev_t *indev, lv_indev_data_t *data);
+
+/**
+ * Count LV_EVENT_VALUE_CHANGED events of the keyboard.
+ *
+ * @param event the event object
+ */
+static void value_changed_cb(lv_event_t *event);
+
+/**
+ * Move the pointer, advance time by one step and let LVGL process the new state.
+ *
+ * @param indev scripted pointer
+ * @param x horizontal position
+ * @param y vertical position
+ * @param state pointer state
+ */
+static void step(lv_indev_t *indev, int32_t x, int32_t y, lv_indev_state_t state);
+
+/**
+ * Find the centres of the first keys of a row along a horizontal line.
+ *
+ * @param keyboard keyboard widget
+ * @param y vertical position of the line
+ * @param xs array to write the horizontal centres into
+ * @param num_keys number of keys to find
+ * @return true if enough keys were found, false otherwise
+ */
+static bool find_keys(lv_obj_t *keyboard, int32_t y, int32_t *xs, int num_keys);
+
+/**
+ * Check the number of reported keys after a gesture.
+ *
+ * @param gesture name of the gesture
+ * @param expected expected number of LV_EVENT_VALUE_CHANGED events
+ * @return true if the number matches, false otherwise
+ */
+static bool check(const char *gesture, int expected);
+
+
+/**
+ * Static functions
+ */
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(disp);
+}
+
+static void read_cb(lv_indev_t *indev, lv_indev_data_t *data) {
+    LV_UNUSED(indev);
+    data->point = pointer_point;
+    data->state = pointer_state;
+}
+
+static void value_changed_cb(lv_event_t *event) {
+    LV_UNUSED(event);
+    num_value_changed++;
+}
+
+static void step(lv_indev_t *indev, int32_t x, int32_t y, lv_indev_state_t state) {
+    pointer_point.x = x;
+    pointer_point.y = y;
+    pointer_state = state;
+    lv_tick_inc(STEP_MS);
+    lv_indev_read(indev);
+}
+
+static bool find_keys(lv_obj_t *keyboard, int32_t y, int32_t *xs, int num_keys) {
+    int found = 0;
+    uint32_t current = LV_BUTTONMATRIX_BUTTON_NONE;
+    int32_t start = 0;
+
+    for (int32_t x = 0; x <= HOR_RES && found < num_keys; ++x) {
+        lv_point_t point = { x, y };
+        uint32_t btn_id = x < HOR_RES ? bbx_keyboard_get_button_at_point(keyboard, &point) : LV_BUTTONMATRIX_BUTTON_NONE;
+        if (btn_id == current) {
+            continue;
+        }
+        if (current != LV_BUTTONMATRIX_BUTTON_NONE) {
+            xs[found++] = (start + x - 1) / 2;
+        }
+        current = btn_id;
+        start = x;
+    }
+
+    return found == num_keys;
+}
+
+static bool check(const char *gesture, int expected) {
+    bool ok = num_value_changed == expected;
+    printf("%s %s: %d key(s) reported, expected %d\n", ok ? "PASS" : "FAIL", gesture, num_value_changed, expected);
+    num_value_changed = 0;
+    return ok;
+}
+
+
+/**
+ * Main
+ */
+
+int main(void) {
+    lv_init();
+
+    lv_display_t *disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_buffers(disp, draw_buffer, NULL, sizeof(draw_buffer), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    lv_indev_t *indev = lv_indev_create();
+    lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(indev, read_cb);
+    lv_indev_set_display(indev, disp);
+
+    bbx_theme_apply(bbx_themes_themes[BBX_THEMES_THEME_BREEZY_DARK]);
+
+    lv_obj_t *textarea = lv_textarea_create(lv_screen_active());
+
+    bbx_keyboard_config_t config;
+    bbx_keyboard_init_config(&config);
+    config.popovers = true;
+    config.height = VER_RES / 2;
+    config.value_changed_callback = value_changed_cb;
+    lv_obj_t *keyboard = bbx_keyboard_create(lv_screen_active(), textarea, &config);
+    lv_obj_align(keyboard, LV_ALIGN_BOTTOM_MID, 0, 0);
+    lv_refr_now(disp);
+
+    /* Use the second row, which consists of letters */
+    lv_area_t coords;
+    lv_obj_get_coords(keyboard, &coords);
+    const int32_t y = coords.y1 + lv_obj_get_height(keyboard) * 3 / 10;
+
+    int32_t xs[3];
+    if (!find_keys(keyboard, y, xs, 3)) {
+        printf("FAIL could not find three keys in a row\n");
+        return EXIT_FAILURE;
+    }
+
+    bool ok = true;
+
+    /* Tap a single key */
+    step(indev, xs[0], y, LV_INDEV_STATE_PRESSED);
+    step(indev, xs[0], y, LV_INDEV_STATE_PRESSED);
+    step(indev, xs[0], y, LV_INDEV_STATE_RELEASED);
+    ok = check("tap", 1) && ok;
+
+    /* Slide across three keys before lifting the finger */
+    step(indev, xs[0], y, LV_INDEV_STATE_PRESSED);
+    for (int i = 0; i < 2; ++i) {
+        const int32_t distance = xs[i + 1] - xs[i];
+        for (int j = 1; j <= 4; ++j) {
+            step(indev, xs[i] + distance * j / 4, y, LV_INDEV_STATE_PRESSED);
+        }
+    }
+    step(indev, xs[2], y, LV_INDEV_STATE_RELEASED);
+    ok = check("drag across three keys", 1) && ok;
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
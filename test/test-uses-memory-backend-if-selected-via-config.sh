@@ -0,0 +1,38 @@
+#!/bin/bash
+
+log=tmp.log
+conf=tmp.conf
+screen=tmp.ppm
+
+source "$(dirname "${BASH_SOURCE[0]}")/helpers.sh"
+
+function clean_up() {
+    rm -f "$log" "$conf" "$screen"
+}
+
+trap clean_up EXIT
+
+info "Writing config"
+cat << EOF > "$conf"
+[general]
+backend=memory
+memory_file=$screen
+EOF
+
+info "Running unl0kr"
+run_unl0kr_async "$log" "$conf"
+
+info "Verifying output"
+if ! grep "Using memory backend" "$log"; then
+    error "Expected memory backend to be selected"
+    cat "$log"
+    exit 1
+fi
+
+if [[ "$(head -c 2 "$screen")" != "P6" ]]; then
+    error "Expected screen to be mirrored into a PPM file"
+    cat "$log"
+    exit 1
+fi
+
+ok
@@ -10,6 +10,7 @@ run_script "$root/build-with-drm.sh" || rc=1
 run_script "$root/test-version-matches-meson-and-changelog.sh" || rc=1
 run_script "$root/test-uses-fb-backend-by-default.sh" || rc=1
 run_script "$root/test-uses-fb-backend-if-selected-via-config.sh" || rc=1
+run_script "$root/test-uses-memory-backend-if-selected-via-config.sh" || rc=1
 run_script "$root/test-uses-drm-backend-if-selected-via-config-and-available.sh" || rc=1
 
 exit $rc
@@ -43,6 +43,10 @@ static void init_opts(ul_cli_opts *opts) {
     opts->config_files = NULL;
     opts->message = NULL;
     opts->newline = true;
+    opts->session_fd = -1;
+    opts->config_snapshot = NULL;
+    opts->write_config_snapshot = NULL;
+    opts->rotation = LV_DISPLAY_ROTATION_0;
 }
 
 static void print_usage() {
@@ -63,12 +67,35 @@ static void print_usage() {
         "                            * /etc/unl0kr.conf\n"
         "                            * /etc/unl0kr.conf.d/* (alphabetically)\n"
         "                            * Override files (in supplied order)\n"
+        "  -S, --config-snapshot=PATH\n"
+        "                            Load the files above (except for overrides) from\n"
+        "                            a snapshot if none of them changed since it was\n"
+        "                            written\n"
+        "  -W, --write-config-snapshot=PATH\n"
+        "                            Write a snapshot of the files above (except for\n"
+        "                            overrides) to PATH and exit\n"
         "  -g, --geometry=NxM[@X,Y]  Force a display size of N horizontal times M\n"
         "                            vertical pixels, offset horizontally by X\n"
         "                            pixels and vertically by Y pixels\n"
         "  -d  --dpi=N               Override the display's DPI value\n"
+        "  -r, --rotate=[0-3]        Rotate the UI to the given orientation (requires\n"
+        "                            the DRM backend). The values match the ones\n"
+        "                            provided by the kernel in\n"
+        "                            /sys/class/graphics/fbcon/rotate.\n"
+        "                            * 0 - normal orientation (0 degree)\n"
+        "                            * 1 - clockwise orientation (90 degrees)\n"
+        "                            * 2 - upside down orientation (180 degrees)\n"
+        "                            * 3 - counterclockwise orientation (270 degrees)\n"
         "  -h, --help                Print this message and exit\n"
         "  -n                        Do not append a newline character to a password\n"
+        "      --record-input=PATH   Record all input events to PATH\n"
+        "      --replay-input=PATH   Replay the input events recorded in PATH instead\n"
+        "                            of using input devices and exit afterwards\n"
+        "      --replay-fast         Replay input events as fast as possible instead\n"
+        "                            of in real time, redrawing after each of them\n"
+        "  -s, --session=FD          Serve consecutive prompts on the SOCK_SEQPACKET\n"
+        "                            socket FD instead of printing a single password\n"
+        "                            (used by unl0kr-agent)\n"
         "  -v, --verbose             Enable more detailed logging output on STDERR\n"
         "  -V, --version             Print the unl0kr version and exit\n");
         /*-------------------------------- 78 CHARS --------------------------------*/
@@ -85,17 +112,24 @@ void ul_cli_parse_opts(int argc, char *argv[], ul_cli_opts *opts) {
     struct option long_opts[] = {
         { "message",         required_argument, NULL, 'm' },
         { "config-override", required_argument, NULL, 'C' },
+        { "config-snapshot", required_argument, NULL, 'S' },
+        { "write-config-snapshot", required_argument, NULL, 'W' },
         { "geometry",        required_argument, NULL, 'g' },
         { "dpi",             required_argument, NULL, 'd' },
+        { "rotate",          required_argument, NULL, 'r' },
         { "help",            no_argument,       NULL, 'h' },
+        { "session",         required_argument, NULL, 's' },
         { "verbose",         no_argument,       NULL, 'v' },
         { "version",         no_argument,       NULL, 'V' },
+        { "record-input",    required_argument, NULL, BBX_CLI_OPT_RECORD_INPUT },
+        { "replay-input",    required_argument, NULL, BBX_CLI_OPT_REPLAY_INPUT },
+        { "replay-fast",     no_argument,       NULL, BBX_CLI_OPT_REPLAY_FAST },
         { NULL, 0, NULL, 0 }
     };
 
     int opt, index = 0;
 
-    while ((opt = getopt_long(argc, argv, "m:C:g:d:hnvV", long_opts, &index)) != -1) {
+    while ((opt = getopt_long(argc, argv, "m:C:S:W:g:d:r:hns:vV", long_opts, &index)) != -1) {
         switch (opt) {
         case 'm':
             opts->message = strdup(optarg);
@@ -109,6 +143,12 @@ void ul_cli_parse_opts(int argc, char *argv[], ul_cli_opts *opts) {
             opts->config_files[opts->num_config_files] = optarg;
             opts->num_config_files++;
             break;
+        case 'S':
+            opts->config_snapshot = optarg;
+            break;
+        case 'W':
+            opts->write_config_snapshot = optarg;
+            break;
         case 'g':
             if (bbx_cli_parse_geometry(optarg, &opts->common) != 0) {
                 exit(EXIT_FAILURE);
@@ -119,18 +159,55 @@ void ul_cli_parse_opts(int argc, char *argv[], ul_cli_opts *opts) {
                 exit(EXIT_FAILURE);
             }
             break;
+        case 'r': {
+            unsigned int orientation;
+            if (sscanf(optarg, "%u", &orientation) != 1 || orientation > 3) {
+                bbx_log(BBX_LOG_LEVEL_ERROR, "Invalid orientation argument \"%s\"", optarg);
+                exit(EXIT_FAILURE);
+            }
+            switch (orientation) {
+                case 0:
+                    opts->rotation = LV_DISPLAY_ROTATION_0;
+                    break;
+                case 1:
+                    opts->rotation = LV_DISPLAY_ROTATION_270;
+                    break;
+                case 2:
+                    opts->rotation = LV_DISPLAY_ROTATION_180;
+                    break;
+                case 3:
+                    opts->rotation = LV_DISPLAY_ROTATION_90;
+                    break;
+            }
+            break;
+        }
         case 'h':
             print_usage();
             exit(EXIT_SUCCESS);
         case 'n':
             opts->newline = false;
             break;
+        case 's':
+            if (sscanf(optarg, "%i", &opts->session_fd) != 1 || opts->session_fd < 0) {
+                bbx_log(BBX_LOG_LEVEL_ERROR, "Invalid session fd argument \"%s\"", optarg);
+                exit(EXIT_FAILURE);
+            }
+            break;
         case 'v':
             opts->common.verbose = true;
             break;
         case 'V':
             bbx_cli_print_version_and_exit("unl0kr");
             break;
+        case BBX_CLI_OPT_RECORD_INPUT:
+            opts->common.record_input = optarg;
+            break;
+        case BBX_CLI_OPT_REPLAY_INPUT:
+            opts->common.replay_input = optarg;
+            break;
+        case BBX_CLI_OPT_REPLAY_FAST:
+            opts->common.replay_fast = true;
+            break;
         default:
             print_usage();
             exit(EXIT_FAILURE);
@@ -7,6 +7,7 @@
 #ifndef UL_COMMAND_LINE_H
 #define UL_COMMAND_LINE_H
 
+#include "lvgl/lvgl.h"
 #include "../shared/cli_common.h"
 
 #include <stdbool.h>
@@ -24,6 +25,14 @@ typedef struct {
     /* Message for a user */
     const char *message;
     bool newline;
+    /* Session socket to serve prompts on or -1 to prompt once */
+    int session_fd;
+    /* Snapshot to load the system configuration from or NULL */
+    const char *config_snapshot;
+    /* Path to write a snapshot of the system configuration to before exiting or NULL */
+    const char *write_config_snapshot;
+    /* Display rotation */
+    lv_display_rotation_t rotation;
 } ul_cli_opts;
 
 /**
@@ -7,6 +7,7 @@
 #include "config.h"
 
 #include "../shared/config.h"
+#include "../shared/config_snapshot.h"
 #include "../shared/log.h"
 #include "../squeek2lvgl/sq2lv.h"
 
@@ -32,131 +33,115 @@
  */
 static int parsing_handler(void* user_data, const char* section, const char* key, const char* value);
 
+/**
+ * Handle parsing events from INIH while recording them into a snapshot.
+ *
+ * @param user_data pointer to user data
+ * @param section current section name
+ * @param key option key
+ * @param value option value
+ * @return 0 on error, non-0 otherwise
+ */
+static int recording_handler(void* user_data, const char* section, const char* key, const char* value);
+
+/**
+ * Parse the configuration files and directories that are shipped with or installed on the system.
+ *
+ * @param opts pointer for writing the parsed options into
+ */
+static void parse_system_locations(ul_config_opts *opts);
+
+/**
+ * Parse a timeout option value, clamping it to one hour.
+ *
+ * @param value timeout in seconds
+ * @param result pointer to a uint16_t to write the timeout into
+ * @return true
+ */
+static bool parse_timeout(const char *value, void *result);
+
+
+/**
+ * Static variables
+ */
+
+static bbx_config_snapshot *recording = NULL;
+
+#define OPTION(section, key, parse, member) BBX_CONFIG_OPTION(section, key, parse, ul_config_opts, member)
+
+/* Keep sorted by section and then by key */
+static const bbx_config_option options[] = {
+    OPTION("general", "animations", bbx_config_parse_bool_option, general.animations),
+    OPTION("general", "backend", bbx_backends_parse_backend_option, general.backend),
+    OPTION("general", "memory_bpp", bbx_backends_parse_memory_bpp_option, general.memory_bpp),
+    OPTION("general", "memory_file", bbx_config_parse_string_option, general.memory_file),
+    OPTION("general", "timeout", parse_timeout, general.timeout),
+    OPTION("hardware keyboard", "layout", bbx_config_parse_string_option, hw_keyboard.layout),
+    OPTION("hardware keyboard", "model", bbx_config_parse_string_option, hw_keyboard.model),
+    OPTION("hardware keyboard", "options", bbx_config_parse_string_option, hw_keyboard.options),
+    OPTION("hardware keyboard", "rules", bbx_config_parse_string_option, hw_keyboard.rules),
+    OPTION("hardware keyboard", "variant", bbx_config_parse_string_option, hw_keyboard.variant),
+    OPTION("input", "keyboard", bbx_config_parse_bool_option, input.keyboard),
+    OPTION("input", "pointer", bbx_config_parse_bool_option, input.pointer),
+    OPTION("input", "touchscreen", bbx_config_parse_bool_option, input.touchscreen),
+    OPTION("keyboard", "autohide", bbx_config_parse_bool_option, keyboard.autohide),
+    OPTION("keyboard", "layout", sq2lv_parse_layout_option, keyboard.layout_id),
+    OPTION("keyboard", "popovers", bbx_config_parse_bool_option, keyboard.popovers),
+    OPTION("quirks", "fbdev_force_refresh", bbx_config_parse_bool_option, quirks.fbdev_force_refresh),
+    OPTION("quirks", "terminal_allow_keyboard_input", bbx_config_parse_bool_option, quirks.terminal_allow_keyboard_input),
+    OPTION("quirks", "terminal_prevent_graphics_mode", bbx_config_parse_bool_option, quirks.terminal_prevent_graphics_mode),
+    OPTION("textarea", "bullet", bbx_config_parse_string_option, textarea.bullet),
+    OPTION("textarea", "obscured", bbx_config_parse_bool_option, textarea.obscured),
+    OPTION("theme", "alternate", bbx_config_parse_theme_option, theme.alternate_id),
+    OPTION("theme", "default", bbx_config_parse_theme_option, theme.default_id),
+};
+
+static const bbx_config_schema schema = { options, sizeof(options) / sizeof(options[0]) };
+
 
 /**
  * Static functions
  */
 
+static bool parse_timeout(const char *value, void *result) {
+    /* Use a max ceiling of 60 minutes (3600 secs) */
+    *(uint16_t *)result = (uint16_t)LV_MIN(strtoul(value, (char **)NULL, 10), 3600);
+    return true;
+}
+
 static int parsing_handler(void* user_data, const char* section, const char* key, const char* value) {
-    ul_config_opts *opts = (ul_config_opts *)user_data;
-
-    if (strcmp(section, "general") == 0) {
-        if (strcmp(key, "animations") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->general.animations))) {
-                return 1;
-            }
-        } else if (strcmp(key, "backend") == 0) {
-            bbx_backends_backend_id_t id = bbx_backends_find_backend_with_name(value);
-            if (id != BBX_BACKENDS_BACKEND_NONE) {
-                opts->general.backend = id;
-                return 1;
-            }
-        } else if (strcmp(key, "timeout") == 0) {
-            /* Use a max ceiling of 60 minutes (3600 secs) */
-            opts->general.timeout = (uint16_t)LV_MIN(strtoul(value, (char **)NULL, 10), 3600);
-            return 1;
-        }
-    } else if (strcmp(section, "keyboard") == 0) {
-        if (strcmp(key, "autohide") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->keyboard.autohide))) {
-                return 1;
-            }
-        } else if (strcmp(key, "layout") == 0) {
-            sq2lv_layout_id_t id = sq2lv_find_layout_with_short_name(value);
-            if (id != SQ2LV_LAYOUT_NONE) {
-                opts->keyboard.layout_id = id;
-                return 1;
-            }
-        } else if (strcmp(key, "popovers") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->keyboard.popovers))) {
-                return 1;
-            }
-        }
-    } else if (strcmp(section, "textarea") == 0) {
-        if (strcmp(key, "obscured") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->textarea.obscured))) {
-                return 1;
-            }
-        } else if (strcmp(key, "bullet") == 0) {
-            char *bullet = strdup(value);
-            if (bullet) {
-                opts->textarea.bullet = bullet;
-                return 1;
-            }
-        }
-    } else if (strcmp(section, "theme") == 0) {
-        if (strcmp(key, "default") == 0) {
-            bbx_themes_theme_id_t id = bbx_themes_find_theme_with_name(value);
-            if (id != BBX_THEMES_THEME_NONE) {
-                opts->theme.default_id = id;
-                return 1;
-            }
-        } else if (strcmp(key, "alternate") == 0) {
-            bbx_themes_theme_id_t id = bbx_themes_find_theme_with_name(value);
-            if (id != BBX_THEMES_THEME_NONE) {
-                opts->theme.alternate_id = id;
-                return 1;
-            }
-        }
-    } else if (strcmp(section, "input") == 0) {
-        if (strcmp(key, "keyboard") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->input.keyboard))) {
-                return 1;
-            }
-        } else if (strcmp(key, "pointer") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->input.pointer))) {
-                return 1;
-            }
-        } else if (strcmp(key, "touchscreen") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->input.touchscreen))) {
-                return 1;
-            }
-        }
-    } else if (strcmp(section, "hardware keyboard") == 0) {
-        if (strcmp(key, "rules") == 0) {
-            opts->hw_keyboard.rules = strdup(value);
-            return 1;
-        } else if (strcmp(key, "model") == 0) {
-            opts->hw_keyboard.model = strdup(value);
-            return 1;
-        } else if (strcmp(key, "layout") == 0) {
-            opts->hw_keyboard.layout = strdup(value);
-            return 1;
-        } else if (strcmp(key, "variant") == 0) {
-            opts->hw_keyboard.variant = strdup(value);
-            return 1;
-        } else if (strcmp(key, "options") == 0) {
-            opts->hw_keyboard.options = strdup(value);
-            return 1;
-        }
-    } else if (strcmp(section, "quirks") == 0) {
-        if (strcmp(key, "fbdev_force_refresh") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->quirks.fbdev_force_refresh))) {
-                return 1;
-            }
-        } else if (strcmp(key, "terminal_prevent_graphics_mode") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->quirks.terminal_prevent_graphics_mode))) {
-                return 1;
-            }
-        } else if (strcmp(key, "terminal_allow_keyboard_input") == 0) {
-            if (bbx_config_parse_bool(value, &(opts->quirks.terminal_allow_keyboard_input))) {
-                return 1;
-            }
-        }
+    if (bbx_config_apply_option(&schema, user_data, section, key, value)) {
+        return 1;
     }
 
     bbx_log(BBX_LOG_LEVEL_ERROR, "Ignoring invalid config value \"%s\" for key \"%s\" in section \"%s\"", value, key, section);
     return 1; /* Return 1 (true) so that we can use the return value of ini_parse exclusively for file-level errors (e.g. file not found) */
 }
 
+static int recording_handler(void* user_data, const char* section, const char* key, const char* value) {
+    bbx_config_snapshot_add_entry(recording, section, key, value);
+    return parsing_handler(user_data, section, key, value);
+}
+
+static void parse_system_locations(ul_config_opts *opts) {
+    ul_config_parse_file("/usr/share/unl0kr/unl0kr.conf", opts);
+    ul_config_parse_directory("/usr/share/unl0kr/unl0kr.conf.d", opts);
+    ul_config_parse_file("/etc/unl0kr.conf", opts);
+    ul_config_parse_directory("/etc/unl0kr.conf.d", opts);
+}
+
 
 /**
  * Public functions
  */
 
 void ul_config_init_opts(ul_config_opts *opts) {
+    bbx_config_check_schemas(&schema, NULL);
+
     opts->general.animations = false;
     opts->general.backend = 0;
+    opts->general.memory_bpp = 32;
+    opts->general.memory_file = NULL;
     opts->general.timeout = 0;
     opts->keyboard.autohide = true;
     opts->keyboard.layout_id = SQ2LV_LAYOUT_US;
@@ -178,7 +163,35 @@ void ul_config_init_opts(ul_config_opts *opts) {
     opts->quirks.terminal_allow_keyboard_input = false;
 }
 
+void ul_config_parse_system_files(ul_config_opts *opts, const char *snapshot_path) {
+    if (snapshot_path && bbx_config_snapshot_load(snapshot_path, parsing_handler, opts)) {
+        return;
+    }
+    parse_system_locations(opts);
+}
+
+bool ul_config_write_snapshot(const char *path) {
+    ul_config_opts opts;
+    ul_config_init_opts(&opts);
+
+    bbx_config_snapshot snapshot;
+    bbx_config_snapshot_init(&snapshot);
+
+    recording = &snapshot;
+    parse_system_locations(&opts);
+    recording = NULL;
+
+    bool ok = bbx_config_snapshot_write(&snapshot, path);
+    bbx_config_snapshot_free(&snapshot);
+    return ok;
+}
+
 void ul_config_parse_directory(const char *path, ul_config_opts *opts) {
+    /* Changes to the list of files invalidate snapshots */
+    if (recording) {
+        bbx_config_snapshot_add_source(recording, path);
+    }
+
     /* Find files in directory */
     char **found = NULL;
     int num_found = 0;
@@ -203,7 +216,10 @@ void ul_config_parse_files(const char **files, int num_files, ul_config_opts *op
 
 void ul_config_parse_file(const char *path, ul_config_opts *opts) {
     bbx_log(BBX_LOG_LEVEL_VERBOSE, "Parsing config file %s", path);
-    if (ini_parse(path, parsing_handler, opts) != 0) {
+    if (recording) {
+        bbx_config_snapshot_add_source(recording, path);
+    }
+    if (ini_parse(path, recording ? recording_handler : parsing_handler, opts) != 0) {
         bbx_log(BBX_LOG_LEVEL_ERROR, "Ignoring invalid config file %s", path);
     }
 }
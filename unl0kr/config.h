@@ -25,6 +25,10 @@ typedef struct {
     bool animations;
     /* Backend to use */
     bbx_backends_backend_id_t backend;
+    /* Bits per pixel to render with when using the memory backend, 16 or 32 */
+    int memory_bpp;
+    /* File to mirror the screen into when using the memory backend, NULL to only render into memory */
+    const char *memory_file;
     /* Timeout (in seconds) - once elapsed, the device will shutdown. 0 (default) to disable */
     uint16_t timeout;
 } ul_config_opts_general;
@@ -112,6 +116,23 @@ typedef struct {
  */
 void ul_config_init_opts(ul_config_opts *opts);
 
+/**
+ * Parse the configuration files and directories under /usr/share and /etc in order, or load them from an
+ * up-to-date snapshot instead.
+ *
+ * @param opts pointer for writing the parsed options into
+ * @param snapshot_path path of a snapshot written by ul_config_write_snapshot or NULL to always parse
+ */
+void ul_config_parse_system_files(ul_config_opts *opts, const char *snapshot_path);
+
+/**
+ * Parse the configuration files and directories under /usr/share and /etc and store the result in a snapshot.
+ *
+ * @param path path of the snapshot file
+ * @return true on success, false otherwise
+ */
+bool ul_config_write_snapshot(const char *path);
+
 /**
  * Find configuration files in a directory and parse them in alphabetic order.
  * 
@@ -6,14 +6,17 @@
 
 #include "command_line.h"
 #include "config.h"
+#include "session.h"
 #include "unl0kr.h"
 
 #include "../shared/backends.h"
 #include "../shared/display.h"
+#include "../shared/draw_threads.h"
 #include "../shared/header.h"
 #include "../shared/indev.h"
 #include "../shared/keyboard.h"
 #include "../shared/log.h"
+#include "../shared/memory_display.h"
 #include "../shared/terminal.h"
 #include "../shared/theme.h"
 #include "../shared/themes.h"
@@ -23,7 +26,9 @@
 
 #include <sys/epoll.h>
 #include <sys/reboot.h>
+#include <sys/uio.h>
 #include <errno.h>
+#include <malloc.h>
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -40,9 +45,18 @@ ul_config_opts conf_opts;
 static bool is_alternate_theme = false;
 static bool is_password_obscured = true;
 static bool is_keyboard_hidden = false;
+static bool is_prompt_active = true;
+static bool is_standby = false;
+static volatile sig_atomic_t is_dump_requested = 0;
 
 static lv_obj_t *container;
+static lv_obj_t *message_container = NULL;
+static lv_obj_t *message_label = NULL;
 static lv_obj_t *keyboard;
+static lv_obj_t *session_cover = NULL;
+
+static const int32_t content_pad_row = 10;
+static int32_t textarea_height;
 
 static int32_t content_height_with_kb;
 static int32_t content_height_without_kb;
@@ -117,6 +131,18 @@ static void toggle_keyboard_hidden(void);
  */
 static void set_keyboard_hidden(bool is_hidden);
 
+/**
+ * Show, update or hide the message for a user.
+ *
+ * @param message message to display or NULL to hide the message
+ */
+static void set_message(const char *message);
+
+/**
+ * Recompute the container's bottom pad that centers the content when the keyboard is hidden.
+ */
+static void update_content_pad_bottom(void);
+
 /**
  * Callback for the pad animation.
  *
@@ -175,6 +201,17 @@ static void keyboard_ready_cb(lv_event_t *event);
  */
 static void textarea_ready_cb(lv_event_t *event);
 
+/**
+ * Hand over the entered password, either to the session controller or by printing it and exiting.
+ *
+ * The textarea's buffer is wiped afterwards. Copies that LVGL left behind in freed heap memory while the
+ * password was typed are only wiped with glibc, see main(). With other C libraries, they stay in the heap
+ * until it is reused or the process exits.
+ *
+ * @param textarea the textarea widget
+ */
+static void submit_password(lv_obj_t *textarea);
+
 /**
  * Print out the entered password and exit.
  *
@@ -182,6 +219,37 @@ static void textarea_ready_cb(lv_event_t *event);
  */
 static void print_password_and_exit(lv_obj_t *textarea);
 
+/**
+ * Wipe the entered password from the textarea's buffer and clear the textarea.
+ *
+ * @param textarea the textarea widget
+ */
+static void clear_password(lv_obj_t *textarea);
+
+/**
+ * Clear the entered password and cover the screen until the next session prompt.
+ *
+ * @param textarea the textarea widget
+ */
+static void end_session_prompt(lv_obj_t *textarea);
+
+/**
+ * Handle prompt requests from the session controller.
+ *
+ * @param message message for a user or NULL
+ */
+static void session_prompt_cb(const char *message);
+
+/**
+ * Handle prompt cancellations from the session controller.
+ */
+static void session_cancel_cb(void);
+
+/**
+ * Handle the session controller closing the session.
+ */
+static void session_close_cb(void);
+
 /**
  * Shuts down the device.
  */
@@ -194,11 +262,23 @@ static void shutdown(void);
  */
 static void sigaction_handler(int signum);
 
+/**
+ * Handle SIGUSR1, which requests a dump of the memory display.
+ *
+ * @param signum the signal's number
+ */
+static void dump_signal_handler(int signum);
+
 /**
  * Restore the terminal and exit from the program with EXIT_FAILURE.
  */
 static void exit_failure();
 
+/**
+ * Restore the terminal and exit from the program with EXIT_SUCCESS once a replayed input trace has ended.
+ */
+static void replay_finished(void);
+
 
 /**
  * Static functions
@@ -234,7 +314,24 @@ static void toggle_password_obscured(void) {
 
 static void set_password_obscured(bool is_obscured) {
     lv_obj_t *textarea = lv_keyboard_get_textarea(keyboard);
+
+    /* Leaving password mode frees the buffer that holds the text without wiping it, so move the text over
+     * through a copy that is wiped afterwards */
+    char *password = NULL;
+    if (!is_obscured && lv_textarea_get_password_mode(textarea)) {
+        password = lv_strdup(lv_textarea_get_text(textarea));
+    }
+    if (password) {
+        clear_password(textarea);
+    }
+
     lv_textarea_set_password_mode(textarea, is_obscured);
+
+    if (password) {
+        lv_textarea_set_text(textarea, password);
+        explicit_bzero(password, strlen(password));
+        lv_free(password);
+    }
 }
 
 static void toggle_kb_btn_clicked_cb(lv_event_t *event) {   
@@ -284,6 +381,53 @@ static void set_keyboard_hidden(bool is_hidden) {
     }
 }
 
+static void set_message(const char *message) {
+    if (!message) {
+        if (message_container) {
+            lv_obj_add_flag(message_container, LV_OBJ_FLAG_HIDDEN);
+            lv_obj_set_style_pad_row(container, 0, LV_PART_MAIN);
+        }
+        update_content_pad_bottom();
+        return;
+    }
+
+    if (!message_container) {
+        /* lv_label does not support wrapping and scrolling simultaneously,
+           so we place it in a scrollable container */
+        message_container = lv_obj_create(container);
+        lv_obj_move_to_index(message_container, 0);
+        lv_obj_set_width(message_container, LV_PCT(100));
+        lv_obj_set_flex_flow(message_container, LV_FLEX_FLOW_COLUMN);
+        lv_obj_set_flex_grow(message_container, 1);
+
+        lv_obj_t *message_spacer = lv_obj_create(message_container);
+        lv_obj_set_width(message_spacer, 0);
+        lv_obj_set_flex_grow(message_spacer, 1);
+
+        message_label = lv_label_create(message_container);
+        lv_obj_set_size(message_label, LV_PCT(100), LV_SIZE_CONTENT);
+    }
+
+    lv_obj_remove_flag(message_container, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_set_style_pad_row(container, content_pad_row, LV_PART_MAIN);
+    lv_label_set_text(message_label, message);
+    update_content_pad_bottom();
+}
+
+static void update_content_pad_bottom(void) {
+    int32_t content_native_height = textarea_height;
+    if (message_container && !lv_obj_has_flag(message_container, LV_OBJ_FLAG_HIDDEN)) {
+        lv_obj_update_layout(message_label);
+        content_native_height += content_pad_row + lv_obj_get_height(message_label);
+    }
+
+    content_pad_bottom_without_kb = (content_height_without_kb - content_native_height) / 2;
+    if (content_pad_bottom_without_kb < content_pad_bottom_with_kb)
+        content_pad_bottom_without_kb = content_pad_bottom_with_kb;
+
+    lv_obj_set_style_pad_bottom(container, is_keyboard_hidden? content_pad_bottom_without_kb : content_pad_bottom_with_kb, LV_PART_MAIN);
+}
+
 static void pad_anim_cb(void *obj, int32_t value) {
     lv_obj_set_style_pad_bottom(obj, value, LV_PART_MAIN);
 }
@@ -343,16 +487,40 @@ static void keyboard_value_changed_cb(lv_event_t *event) {
 }
 
 static void keyboard_ready_cb(lv_event_t *event) {
-    print_password_and_exit(lv_keyboard_get_textarea(lv_event_get_target(event)));
+    submit_password(lv_keyboard_get_textarea(lv_event_get_target(event)));
 }
 
 static void textarea_ready_cb(lv_event_t *event) {
-    print_password_and_exit(lv_event_get_target(event));
+    submit_password(lv_event_get_target(event));
+}
+
+static void submit_password(lv_obj_t *textarea) {
+    if (cli_opts.session_fd < 0) {
+        print_password_and_exit(textarea);
+        return;
+    }
+
+    /* Input can still arrive while the screen is covered between prompts */
+    if (!is_prompt_active) {
+        return;
+    }
+
+    ul_session_send_password(lv_textarea_get_text(textarea));
+    end_session_prompt(textarea);
 }
 
 static void print_password_and_exit(lv_obj_t *textarea) {
-    /* Print the password to STDOUT */
-    printf(cli_opts.newline? "%s\n" : "%s", lv_textarea_get_text(textarea));
+    /* Write the password to STDOUT straight from the textarea, bypassing stdio buffers */
+    const char *password = lv_textarea_get_text(textarea);
+    struct iovec iov[2];
+    iov[0].iov_base = (void *)password;
+    iov[0].iov_len = strlen(password);
+    iov[1].iov_base = "\n";
+    iov[1].iov_len = 1;
+    if (writev(STDOUT_FILENO, iov, cli_opts.newline ? 2 : 1) < 0) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not write password: %s", strerror(errno));
+    }
+    clear_password(textarea);
 
     /* Clear the screen so that when the password field was unobscured, it cannot
      * leak via stale display buffers after we've exited */
@@ -367,28 +535,120 @@ static void print_password_and_exit(lv_obj_t *textarea) {
     sigaction_handler(SIGTERM);
 }
 
+static void clear_password(lv_obj_t *textarea) {
+    /* The textarea owns its text buffer, so overwrite it in place before releasing it */
+    char *text = (char *)lv_textarea_get_text(textarea);
+    explicit_bzero(text, strlen(text));
+    lv_textarea_set_text(textarea, "");
+}
+
+static void end_session_prompt(lv_obj_t *textarea) {
+    is_prompt_active = false;
+    clear_password(textarea);
+
+    /* Cover the screen so that an unobscured password cannot linger between prompts */
+    if (!session_cover) {
+        session_cover = lv_obj_create(lv_layer_top());
+        lv_obj_set_size(session_cover, LV_PCT(100), LV_PCT(100));
+        lv_obj_set_pos(session_cover, 0, 0);
+        lv_obj_set_style_bg_opa(session_cover, LV_OPA_COVER, LV_PART_MAIN);
+    }
+    lv_obj_set_style_bg_color(session_cover, lv_color_hex(get_theme(is_alternate_theme)->window.bg_color), LV_PART_MAIN);
+    lv_obj_remove_flag(session_cover, LV_OBJ_FLAG_HIDDEN);
+    lv_refr_now(lv_display_get_default()); /* Force the screen to be drawn */
+}
+
+static void session_prompt_cb(const char *message) {
+    /* Everything but the terminal and the first frame is ready at this point */
+    if (is_standby) {
+        bbx_terminal_prepare_current_terminal(!conf_opts.quirks.terminal_prevent_graphics_mode, !conf_opts.quirks.terminal_allow_keyboard_input);
+        is_standby = false;
+    }
+
+    if (is_prompt_active) {
+        bbx_log(BBX_LOG_LEVEL_WARNING, "Received a prompt while another one is active, replacing it");
+        ul_session_send_cancelled();
+    }
+
+    /* Input may have reached the textarea while no prompt was shown */
+    lv_obj_t *textarea = lv_keyboard_get_textarea(keyboard);
+    clear_password(textarea);
+    set_message(message);
+
+    if (session_cover) {
+        lv_obj_add_flag(session_cover, LV_OBJ_FLAG_HIDDEN);
+    }
+    is_prompt_active = true;
+
+    /* Restart the inactivity timeout for the new prompt */
+    lv_display_trigger_activity(NULL);
+
+    /* Show the prompt right away instead of waiting for the refresh timer */
+    lv_refr_now(lv_display_get_default());
+}
+
+static void session_cancel_cb(void) {
+    /* The prompt may have been answered already, in which case there is nothing to cancel */
+    if (!is_prompt_active) {
+        return;
+    }
+
+    ul_session_send_cancelled();
+    end_session_prompt(lv_keyboard_get_textarea(keyboard));
+}
+
+static void session_close_cb(void) {
+    if (is_prompt_active) {
+        end_session_prompt(lv_keyboard_get_textarea(keyboard));
+    }
+    sigaction_handler(SIGTERM);
+}
+
 static void shutdown(void) {
+    /* Nothing is shown in standby, so the power key isn't meant for us */
+    if (is_standby) {
+        return;
+    }
+
     sync();
     reboot(RB_POWER_OFF);
 }
 
 static void sigaction_handler(int signum) {
     LV_UNUSED(signum);
-    bbx_terminal_reset_current_terminal();
+    if (!is_standby) {
+        bbx_terminal_reset_current_terminal();
+    }
     exit(0);
 }
 
+static void dump_signal_handler(int signum) {
+    LV_UNUSED(signum);
+    is_dump_requested = 1;
+}
+
 static void exit_failure() {
     bbx_terminal_reset_current_terminal();
     exit(EXIT_FAILURE);
 }
 
+static void replay_finished(void) {
+    bbx_terminal_reset_current_terminal();
+    exit(EXIT_SUCCESS);
+}
+
 
 /**
  * Main
  */
 
 int main(int argc, char *argv[]) {
+#ifdef M_PERTURB
+    /* The textarea grows its text buffer with realloc, which leaves copies of the password in freed memory.
+     * Have glibc overwrite all memory on release, which costs a memset per allocation in this small UI. */
+    mallopt(M_PERTURB, 0x5a);
+#endif
+
     /* Parse command line options */
     ul_cli_parse_opts(argc, argv, &cli_opts);
 
@@ -401,15 +661,20 @@ int main(int argc, char *argv[]) {
     bbx_log(BBX_LOG_LEVEL_VERBOSE, "unl0kr %s", PROJECT_VERSION);
 
     /* Parse config files */
+    if (cli_opts.write_config_snapshot) {
+        exit(ul_config_write_snapshot(cli_opts.write_config_snapshot) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
     ul_config_init_opts(&conf_opts);
-    ul_config_parse_file("/usr/share/unl0kr/unl0kr.conf", &conf_opts);
-    ul_config_parse_directory("/usr/share/unl0kr/unl0kr.conf.d", &conf_opts);
-    ul_config_parse_file("/etc/unl0kr.conf", &conf_opts);
-    ul_config_parse_directory("/etc/unl0kr.conf.d", &conf_opts);
+    ul_config_parse_system_files(&conf_opts, cli_opts.config_snapshot);
     ul_config_parse_files(cli_opts.config_files, cli_opts.num_config_files, &conf_opts);
 
+    /* In session mode, start in standby and only take over the TTY once the first prompt arrives */
+    is_standby = cli_opts.session_fd >= 0;
+
     /* Prepare current TTY and clean up on termination */
-    bbx_terminal_prepare_current_terminal(!conf_opts.quirks.terminal_prevent_graphics_mode, !conf_opts.quirks.terminal_allow_keyboard_input);
+    if (!is_standby) {
+        bbx_terminal_prepare_current_terminal(!conf_opts.quirks.terminal_prevent_graphics_mode, !conf_opts.quirks.terminal_allow_keyboard_input);
+    }
     struct sigaction action;
     memset(&action, 0, sizeof(action));
     action.sa_handler = sigaction_handler;
@@ -417,7 +682,7 @@ int main(int argc, char *argv[]) {
     sigaction(SIGTERM, &action, NULL);
 
     /* Initialise LVGL and set up logging callback */
-    lv_init();
+    bbx_draw_threads_init_lvgl();
     lv_log_register_print_cb(bbx_log_print_cb);
 
     /* Populate display config */
@@ -427,7 +692,10 @@ int main(int argc, char *argv[]) {
         .x_offset = cli_opts.common.x_offset,
         .y_offset = cli_opts.common.y_offset,
         .dpi = cli_opts.common.dpi,
-        .fbdev_force_refresh = conf_opts.quirks.fbdev_force_refresh
+        .fbdev_force_refresh = conf_opts.quirks.fbdev_force_refresh,
+        .memory_file = conf_opts.general.memory_file,
+        .memory_bpp = conf_opts.general.memory_bpp,
+        .rotation = cli_opts.rotation
     };
 
     /* Initialize display */
@@ -436,6 +704,12 @@ int main(int argc, char *argv[]) {
         exit_failure();
     }
 
+    /* Dump the screen of the memory backend on request, e.g. for rendering tests */
+    if (conf_opts.general.backend == BBX_BACKENDS_BACKEND_MEMORY && conf_opts.general.memory_file) {
+        action.sa_handler = dump_signal_handler;
+        sigaction(SIGUSR1, &action, NULL);
+    }
+
     int fd_epoll = epoll_create1(EPOLL_CLOEXEC);
     if (fd_epoll == -1) {
         bbx_log(BBX_LOG_LEVEL_ERROR, "epoll_create1() is failed");
@@ -447,12 +721,17 @@ int main(int argc, char *argv[]) {
         .keymap = &conf_opts.hw_keyboard,
         .keyboard = conf_opts.input.keyboard,
         .pointer = conf_opts.input.pointer,
-        .touchscreen = conf_opts.input.touchscreen
+        .touchscreen = conf_opts.input.touchscreen,
+        .rotation = display_config.rotation,
+        .record_path = cli_opts.common.record_input,
+        .replay_path = cli_opts.common.replay_input,
+        .replay_fast = cli_opts.common.replay_fast
     };
     if (bbx_indev_init(fd_epoll, &input_config) == 0)
         exit_failure();
 
     bbx_indev_set_key_power_cb(shutdown);
+    bbx_indev_set_replay_finished_cb(replay_finished);
 
     /* Hide the on-screen keyboard by default if a physical keyboard is connected */
     if (conf_opts.keyboard.autohide && bbx_indev_is_keyboard_connected()) {
@@ -506,29 +785,6 @@ int main(int argc, char *argv[]) {
     lv_obj_set_style_pad_left(container, 20, LV_PART_MAIN);
     lv_obj_set_style_pad_right(container, 20, LV_PART_MAIN);
 
-    int32_t content_pad_row = 10;
-
-    /* Message for a user */
-    lv_obj_t *message_label = NULL;
-    if (cli_opts.message) {
-        lv_obj_set_style_pad_row(container, content_pad_row, LV_PART_MAIN);
-
-        /* lv_label does not support wrapping and scrolling simultaneously,
-           so we place it in a scrollable container */
-        lv_obj_t *message_container = lv_obj_create(container);
-        lv_obj_set_width(message_container, LV_PCT(100));
-        lv_obj_set_flex_flow(message_container, LV_FLEX_FLOW_COLUMN);
-        lv_obj_set_flex_grow(message_container, 1);
-
-        lv_obj_t *message_spacer = lv_obj_create(message_container);
-        lv_obj_set_width(message_spacer, 0);
-        lv_obj_set_flex_grow(message_spacer, 1);
-
-        message_label = lv_label_create(message_container);
-        lv_obj_set_size(message_label, LV_PCT(100), LV_SIZE_CONTENT);
-        lv_label_set_text(message_label, cli_opts.message);
-    }
-
     /* Textarea flexbox */
     lv_obj_t *textarea_container = lv_obj_create(container);
     lv_obj_set_size(textarea_container, LV_PCT(100), LV_SIZE_CONTENT);
@@ -549,7 +805,7 @@ int main(int argc, char *argv[]) {
     lv_group_add_obj(keyboard_input_group, textarea);
 
     lv_obj_update_layout(textarea);
-    const int32_t textarea_height = lv_obj_get_height(textarea);
+    textarea_height = lv_obj_get_height(textarea);
 
     /* Reveal / obscure password button */
     lv_obj_t *toggle_pw_btn = lv_button_create(textarea_container);
@@ -562,17 +818,8 @@ int main(int argc, char *argv[]) {
     /* The bottom pad is used to center content when the keyboard is hidden */
     content_pad_bottom_with_kb = 20;
 
-    int32_t content_native_height = textarea_height;
-    if (cli_opts.message) {
-        lv_obj_update_layout(message_label);
-        content_native_height += content_pad_row + lv_obj_get_height(message_label);
-    }
-
-    content_pad_bottom_without_kb = (content_height_without_kb - content_native_height) / 2;
-    if (content_pad_bottom_without_kb < content_pad_bottom_with_kb)
-        content_pad_bottom_without_kb = content_pad_bottom_with_kb;
-
-    lv_obj_set_style_pad_bottom(container, is_keyboard_hidden? content_pad_bottom_without_kb : content_pad_bottom_with_kb, LV_PART_MAIN);
+    /* Message for a user (also computes the bottom pad) */
+    set_message(cli_opts.message);
 
     /* Keyboard (after textarea / label so that key popovers are not drawn over) */
     bbx_keyboard_config_t keyboard_config;
@@ -585,16 +832,30 @@ int main(int argc, char *argv[]) {
 
     keyboard = bbx_keyboard_create(screen, textarea, &keyboard_config);
 
-    /* Apply keyboard options */
-    sq2lv_switch_layout(keyboard, conf_opts.keyboard.layout_id);
+    /* The layout was already applied by bbx_keyboard_create, only sync the dropdown */
     lv_dropdown_set_selected(header_widgets.layout_dropdown, conf_opts.keyboard.layout_id);
 
+    /* In session mode, wait for the first prompt without drawing anything */
+    if (cli_opts.session_fd >= 0) {
+        ul_session_callbacks_t session_callbacks = {
+            .prompt_callback = session_prompt_cb,
+            .cancel_callback = session_cancel_cb,
+            .close_callback = session_close_cb
+        };
+        if (!ul_session_init(cli_opts.session_fd, fd_epoll, &session_callbacks)) {
+            exit_failure();
+        }
+        is_prompt_active = false;
+    }
+
     /* Periodically run timer / task handler */
     uint32_t timeout = conf_opts.general.timeout * 1000; /* ms */
     while(1) {
-        uint32_t time_till_next = lv_timer_handler();
+        /* In standby, LVGL's timers (including display refreshes) are paused until the first prompt */
+        uint32_t time_till_next = is_standby ? LV_NO_TIMER_READY : lv_timer_handler();
 
-        if (timeout != 0) {
+        /* Between session prompts nobody is expected to interact with the device */
+        if (timeout != 0 && is_prompt_active) {
             uint32_t time_idle = lv_display_get_inactive_time(NULL);
             if (time_idle >= timeout)
                 shutdown();
@@ -613,8 +874,13 @@ int main(int argc, char *argv[]) {
             handler();
             continue;
         }
-        if (errno == EINTR)
+        if (errno == EINTR) {
+            if (is_dump_requested) {
+                is_dump_requested = 0;
+                bbx_memory_display_request_dump();
+            }
             continue;
+        }
 
         bbx_log(BBX_LOG_LEVEL_ERROR, "epoll_wait() is failed");
         exit_failure();
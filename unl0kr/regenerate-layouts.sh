@@ -3,10 +3,20 @@
 # Copyright 2021 Johannes Marbach
 # SPDX-License-Identifier: GPL-3.0-or-later
 
+# Additional arguments (e.g. --squeekboard-dir and --cache-dir) are passed on to squeek2lvgl.py. Set
+# SQ2LV_PYTHON to a Python interpreter with PyYAML installed to skip pipenv.
 
-cd ../squeek2lvgl
-pipenv install
-pipenv run python squeek2lvgl.py \
+
+cd "$(dirname "${BASH_SOURCE[0]}")/../squeek2lvgl"
+
+if [ -n "$SQ2LV_PYTHON" ]; then
+    squeek2lvgl=("$SQ2LV_PYTHON" squeek2lvgl.py)
+else
+    pipenv install
+    squeek2lvgl=(pipenv run python squeek2lvgl.py)
+fi
+
+"${squeek2lvgl[@]}" \
     --input us.yaml \
       --name "US English" \
     --input de.yaml \
@@ -19,4 +29,5 @@ pipenv run python squeek2lvgl.py \
     --extra-top-row-upper "! @ # $ % ^ & * ( )" \
     --output ../unl0kr \
     --surround-space-with-arrows \
-    --shift-keycap '\xef\x8d\x9b'
+    --shift-keycap '\xef\x8d\x9b' \
+    "$@"
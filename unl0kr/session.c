@@ -0,0 +1,150 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "session.h"
+
+#include "../shared/log.h"
+
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/**
+ * Static variables
+ */
+
+static int session_fd = -1;
+static ul_session_callbacks_t session_callbacks;
+
+/**
+ * Static prototypes
+ */
+
+/**
+ * Handle a readable session socket.
+ */
+static void on_session_event();
+
+/**
+ * Close the session socket and notify the application.
+ */
+static void close_session(void);
+
+/**
+ * Static functions
+ */
+
+static void on_session_event() {
+    ssize_t size = recv(session_fd, NULL, 0, MSG_PEEK | MSG_TRUNC);
+    if (size < 0) {
+        if (errno == EINTR || errno == EAGAIN) {
+            return;
+        }
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not read from session socket: %s", strerror(errno));
+        close_session();
+        return;
+    }
+
+    if (size == 0) {
+        bbx_log(BBX_LOG_LEVEL_VERBOSE, "Session closed by controller");
+        close_session();
+        return;
+    }
+
+    char *message = malloc(size + 1);
+    if (!message) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not allocate memory for session message");
+        recv(session_fd, NULL, 0, 0); /* Drop the message */
+        return;
+    }
+
+    size = recv(session_fd, message, size, 0);
+    if (size <= 0) {
+        free(message);
+        return;
+    }
+    message[size] = '\0';
+
+    switch (message[0]) {
+    case UL_SESSION_PROMPT:
+        if (session_callbacks.prompt_callback) {
+            session_callbacks.prompt_callback(message[1] != '\0' ? message + 1 : NULL);
+        }
+        break;
+    case UL_SESSION_CANCEL:
+        if (session_callbacks.cancel_callback) {
+            session_callbacks.cancel_callback();
+        }
+        break;
+    default:
+        bbx_log(BBX_LOG_LEVEL_WARNING, "Ignoring unknown session command '%c'", message[0]);
+        break;
+    }
+
+    free(message);
+}
+
+static void close_session(void) {
+    close(session_fd);
+    session_fd = -1;
+
+    if (session_callbacks.close_callback) {
+        session_callbacks.close_callback();
+    }
+}
+
+/**
+ * Public functions
+ */
+
+bool ul_session_init(int fd, int fd_epoll, const ul_session_callbacks_t *callbacks) {
+    /* Do not leak the session into child processes */
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = __extension__ (void*) on_session_event;
+
+    if (epoll_ctl(fd_epoll, EPOLL_CTL_ADD, fd, &event) == -1) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "EPOLL_CTL_ADD for session socket is failed: %s", strerror(errno));
+        return false;
+    }
+
+    session_fd = fd;
+    session_callbacks = *callbacks;
+    return true;
+}
+
+bool ul_session_send_password(const char *password) {
+    /* Gather the prefix and the password into a single message without copying the password */
+    struct iovec iov[2];
+    iov[0].iov_base = "+";
+    iov[0].iov_len = 1;
+    iov[1].iov_base = (void *)password;
+    iov[1].iov_len = strlen(password);
+
+    struct msghdr message = { 0 };
+    message.msg_iov = iov;
+    message.msg_iovlen = 2;
+
+    if (sendmsg(session_fd, &message, MSG_NOSIGNAL) < 0) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not send password to session: %s", strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+bool ul_session_send_cancelled(void) {
+    if (send(session_fd, "-", 1, MSG_NOSIGNAL) < 0) {
+        bbx_log(BBX_LOG_LEVEL_ERROR, "Could not send cancellation to session: %s", strerror(errno));
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,69 @@
+/**
+ * Copyright 2025 buffybox contributors
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef UL_SESSION_H
+#define UL_SESSION_H
+
+#include <stdbool.h>
+
+/**
+ * Session protocol
+ *
+ * In session mode, unl0kr stays running and serves consecutive password prompts over a SOCK_SEQPACKET
+ * socket. Every message from the controller starts with a command byte:
+ *
+ * - UL_SESSION_PROMPT followed by an optional message shows a new prompt
+ * - UL_SESSION_CANCEL aborts the current prompt
+ *
+ * unl0kr answers every prompt with exactly one message in the format used by systemd password agents:
+ * '+' followed by the password if one was entered, or a single '-' if the prompt was cancelled. Closing
+ * the socket makes unl0kr exit.
+ *
+ * Until the first prompt arrives, unl0kr stays in standby: it is fully initialised but has neither taken
+ * over the terminal nor drawn anything, so it can be started ahead of time and show a prompt within a
+ * single frame.
+ */
+
+#define UL_SESSION_PROMPT 'P'
+#define UL_SESSION_CANCEL 'C'
+
+/**
+ * Session event callbacks
+ */
+typedef struct {
+    /* Called when a new prompt is requested, message is NULL if none was provided */
+    void (*prompt_callback)(const char *message);
+    /* Called when the current prompt is cancelled */
+    void (*cancel_callback)(void);
+    /* Called when the controller has closed the session */
+    void (*close_callback)(void);
+} ul_session_callbacks_t;
+
+/**
+ * Start serving prompts on a session socket.
+ *
+ * @param fd session socket (owned by the session from now on)
+ * @param fd_epoll epoll instance of the main loop
+ * @param callbacks session event callbacks
+ * @return true on success, false otherwise
+ */
+bool ul_session_init(int fd, int fd_epoll, const ul_session_callbacks_t *callbacks);
+
+/**
+ * Answer the current prompt with a password.
+ *
+ * @param password entered password
+ * @return true on success, false otherwise
+ */
+bool ul_session_send_password(const char *password);
+
+/**
+ * Answer the current prompt with a cancellation.
+ *
+ * @return true on success, false otherwise
+ */
+bool ul_session_send_cancelled(void);
+
+#endif /* UL_SESSION_H */
@@ -4,13 +4,18 @@
 
 #include <sys/epoll.h>
 #include <sys/inotify.h>
-#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/signalfd.h>
 #include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/timerfd.h>
 #include <sys/un.h>
 #include <sys/wait.h>
-#include <assert.h>
 #include <dirent.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
 #include <signal.h>
 #include <stdbool.h>
 #include <stdint.h>
@@ -22,11 +27,26 @@
 
 #include <ini.h>
 
-#define UNUSED(x) ((void)x)
+#include "session.h"
+
+#define ASK_FOLDER "/run/systemd/ask-password"
+
+/* How long the owner of an answered request may take to remove its file (in microseconds) */
+#define REMOVAL_TIMEOUT 20000000
+
+/* How long the last entered password may answer AcceptCached requests, matching the timeout of systemd's
+   kernel keyring cache (in microseconds) */
+#define CACHE_TIMEOUT 150000000
+
+/* How long a persistent or standby agent waits for new requests by default (in microseconds) */
+#define IDLE_TIMEOUT 30000000
 
 struct Request
 {
     uint64_t not_after;
+    /* Time at which the request was answered or 0 if it is still pending */
+    uint64_t answered_at;
+    char* name;
     char* file;
     char* socket;
     char* message;
@@ -35,11 +55,15 @@ struct Request
     bool accept_cached;
     bool echo;
     bool silent;
+    /* The file was removed while the request was being prompted for */
+    bool removed;
 };
 
 void Request_init(struct Request* req)
 {
     req->not_after = 0;
+    req->answered_at = 0;
+    req->name = NULL;
     req->file = NULL;
     req->socket = NULL;
     req->message = NULL;
@@ -48,10 +72,13 @@ void Request_init(struct Request* req)
     req->accept_cached = false;
     req->echo = false;
     req->silent = false;
+    req->removed = false;
 }
 
 void Request_free(struct Request* req)
 {
+    if (req->name)
+        free(req->name);
     if (req->file)
         free(req->file);
     if (req->socket)
@@ -62,35 +89,93 @@ void Request_free(struct Request* req)
         free(req->icon);
 }
 
-void Request_reset(struct Request* req)
+/* A reply of unl0kr in the format expected by systemd ('+' followed by the password, or '-'). It is
+   kept in locked memory that is excluded from core dumps and forked children, and it is wiped before
+   the memory is released. */
+struct Secret
 {
-    Request_free(req);
-    Request_init(req);
-}
+    char* data;
+    size_t size;
+    size_t capacity;
+};
 
-struct Request request;
-int fd_epoll, fd_inotify;
-pid_t pid_unl0kr;
-bool unl0kr_exited;
+int Secret_alloc(struct Secret* secret, size_t capacity)
+{
+    void* data = mmap(NULL, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) {
+        int ret = errno;
+        perror("mmap() is failed");
+        return ret;
+    }
 
-timer_t id_timer;
-enum {
-    NO_ACTION,
-    TERMINATE_UNL0KR,
-    KILL_UNL0KR
-} timer_action;
-bool timer_expired;
+    /* Not fatal, RLIMIT_MEMLOCK may be too low */
+    if (mlock(data, capacity) != 0)
+        perror("mlock() is failed");
+    if (madvise(data, capacity, MADV_DONTDUMP) != 0)
+        perror("madvise(MADV_DONTDUMP) is failed");
+#ifdef MADV_WIPEONFORK
+    if (madvise(data, capacity, MADV_WIPEONFORK) != 0)
+        perror("madvise(MADV_WIPEONFORK) is failed");
+#endif
+
+    secret->data = data;
+    secret->size = 0;
+    secret->capacity = capacity;
+    return 0;
+}
 
-void erase_and_free(char* p)
+void Secret_free(struct Secret* secret)
 {
-    const size_t length = strlen(p);
-    for (size_t i = 0; i < length; i++)
-        p[i] = 0;
+    if (!secret->data)
+        return;
+
+    explicit_bzero(secret->data, secret->capacity);
+    munlock(secret->data, secret->capacity);
+    munmap(secret->data, secret->capacity);
 
-    free(p);
+    secret->data = NULL;
+    secret->size = 0;
+    secret->capacity = 0;
 }
 
-int send_password(const char *password)
+/* Pending and answered requests ordered by NotAfter, requests without a deadline last */
+struct Request** queue = NULL;
+size_t queue_length = 0;
+
+/* The request that is currently being prompted for */
+struct Request* request = NULL;
+
+/* The last entered password, used to answer requests with AcceptCached */
+struct Secret cached_password = { NULL, 0, 0 };
+uint64_t cached_at = 0;
+
+/* All events are delivered through fd_epoll and handled synchronously */
+int fd_epoll, fd_inotify, fd_signal, fd_timer;
+
+/* Set once SIGTERM or SIGINT was received */
+bool terminated = false;
+
+/* Reuse a single unl0kr instance for consecutive requests */
+bool persistent = false;
+
+/* Keep an initialised unl0kr waiting in standby for the next request */
+bool standby = false;
+int fd_session = -1;
+int fd_pidfd = -1;
+pid_t pid_session = 0;
+
+/* How long a persistent or standby agent waits for new requests once the queue is empty (in
+   microseconds), zero waits until the agent is terminated */
+uint64_t idle_timeout = IDLE_TIMEOUT;
+
+uint64_t now_usec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+int send_password(const struct Request* req, const char* data, size_t size)
 {
         int fd_socket = socket(AF_UNIX, SOCK_DGRAM|SOCK_CLOEXEC, 0);
         if (fd_socket < 0) {
@@ -101,10 +186,10 @@ int send_password(const char *password)
 
         struct sockaddr_un address;
         address.sun_family = AF_UNIX;
-        strncpy(address.sun_path, request.socket, sizeof(address.sun_path) - 1);
+        strncpy(address.sun_path, req->socket, sizeof(address.sun_path) - 1);
         address.sun_path[sizeof(address.sun_path) - 1] = 0;
 
-        ssize_t n = sendto(fd_socket, password, strlen(password), MSG_NOSIGNAL, (const struct sockaddr*) &address, sizeof(address));
+        ssize_t n = sendto(fd_socket, data, size, MSG_NOSIGNAL, (const struct sockaddr*) &address, sizeof(address));
         if (n < 0) {
             int ret = errno;
             perror("sendto() is failed");
@@ -174,269 +259,385 @@ int ini_parser(void* user, const char* section, const char* name, const char* va
     return 1;
 }
 
-int find_request(char** ret_file)
+struct Request* find_request(const char* name, size_t* ret_index)
 {
-    const char* ask_folder = "/run/systemd/ask-password";
-    const size_t ask_folder_length = strlen(ask_folder);
-
-    DIR* dir = opendir(ask_folder);
-    if (!dir) {
-        int ret = errno;
-        if (errno != ENOENT) {
-            fprintf(stderr, "Can't open '%s': %s\n", ask_folder, strerror(errno));
+    for (size_t i = 0; i < queue_length; i++) {
+        if (strcmp(queue[i]->name, name) == 0) {
+            if (ret_index)
+                *ret_index = i;
+            return queue[i];
         }
-        return ret;
     }
+    return NULL;
+}
 
-    struct dirent* entry;
-    while ((entry = readdir(dir))) {
-        if (entry->d_type != DT_REG && entry->d_type != DT_LNK)
-            continue;
+void drop_request(size_t index)
+{
+    Request_free(queue[index]);
+    free(queue[index]);
+    memmove(&queue[index], &queue[index + 1], (queue_length - index - 1) * sizeof(struct Request*));
+    queue_length--;
+}
 
-        if (strncmp(entry->d_name, "ask.", 4) != 0)
-            continue;
+int add_request(const char* name)
+{
+    if (strncmp(name, "ask.", 4) != 0 || find_request(name, NULL))
+        return 0;
 
-        break;
-    }
-    if (!entry) {
-        closedir(dir);
-        return ENOENT;
+    struct Request* req = malloc(sizeof(struct Request));
+    struct Request** new_queue = realloc(queue, (queue_length + 1) * sizeof(struct Request*));
+    if (!req || !new_queue) {
+        free(req);
+        fprintf(stderr, "Out of memory\n");
+        return ENOMEM;
     }
+    queue = new_queue;
 
-    char* file = malloc(ask_folder_length + 1 + strlen(entry->d_name) + 1);
-    if (!file) {
-        closedir(dir);
+    Request_init(req);
+    req->name = strdup(name);
+    req->file = malloc(strlen(ASK_FOLDER) + 1 + strlen(name) + 1);
+    if (!req->name || !req->file) {
+        Request_free(req);
+        free(req);
         fprintf(stderr, "Out of memory\n");
         return ENOMEM;
     }
+    sprintf(req->file, "%s/%s", ASK_FOLDER, name);
 
-    strcpy(file, ask_folder);
-    strcpy(file + ask_folder_length, "/");
-    strcpy(file + ask_folder_length + 1, entry->d_name);
+    int r = ini_parse(req->file, ini_parser, req);
+    if (r != 0) {
+        /* Don't prompt for it, but keep track of it until it is removed */
+        fprintf(stderr, "The file '%s' can't be parsed: %d\n", req->file, r);
+        req->answered_at = now_usec();
+    }
 
-    closedir(dir);
+    /* Keep the queue ordered by deadline, preserving arrival order for equal deadlines */
+    const uint64_t deadline = req->not_after != 0 ? req->not_after : UINT64_MAX;
+    size_t index = queue_length;
+    while (index > 0) {
+        const uint64_t other = queue[index - 1]->not_after != 0 ? queue[index - 1]->not_after : UINT64_MAX;
+        if (other <= deadline)
+            break;
+        index--;
+    }
+    memmove(&queue[index + 1], &queue[index], (queue_length - index) * sizeof(struct Request*));
+    queue[index] = req;
+    queue_length++;
 
-    *ret_file = file;
     return 0;
 }
 
+void remove_request(const char* name)
+{
+    size_t index;
+    struct Request* req = find_request(name, &index);
+    if (!req)
+        return;
+
+    /* The current request is still referenced by the prompt, it is dropped afterwards */
+    if (req == request) {
+        req->removed = true;
+        return;
+    }
+
+    drop_request(index);
+}
+
+void prune_requests()
+{
+    /* Backwards, since dropping a request shifts the ones after it */
+    for (size_t i = queue_length; i > 0; i--) {
+        struct stat st;
+        if (lstat(queue[i - 1]->file, &st) == 0 || errno != ENOENT)
+            continue;
+
+        remove_request(queue[i - 1]->name);
+    }
+}
+
+int scan_requests()
+{
+    DIR* dir = opendir(ASK_FOLDER);
+    if (!dir) {
+        int ret = errno;
+        fprintf(stderr, "Can't open '%s': %s\n", ASK_FOLDER, strerror(errno));
+        return ret;
+    }
+
+    int ret = 0;
+    struct dirent* entry;
+    while ((entry = readdir(dir))) {
+        if (entry->d_type != DT_REG && entry->d_type != DT_LNK)
+            continue;
+
+        ret = add_request(entry->d_name);
+        if (ret != 0)
+            break;
+    }
+
+    closedir(dir);
+    return ret;
+}
+
 int process_inotify_events()
 {
-    /* We expect only IN_DELETE_SELF and IN_IGNORED */
-    size_t buffer_size = sizeof(struct inotify_event) * 2;
-    uint8_t buffer[buffer_size];
+    uint8_t buffer[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+
+    for (;;) {
+        ssize_t block_size = read(fd_inotify, buffer, sizeof(buffer));
+        if (block_size < 0) {
+            if (errno == EAGAIN)
+                return 0;
+            int ret = errno;
+            perror("read() is failed");
+            return ret;
+        }
+
+        for (uint8_t* p = buffer; p < buffer + block_size; ) {
+            struct inotify_event* ievent = (struct inotify_event*) p;
+            p += sizeof(struct inotify_event) + ievent->len;
+
+            if (ievent->mask & IN_Q_OVERFLOW) {
+                /* Some events were lost, resynchronise the queue with the folder itself */
+                prune_requests();
+                int r = scan_requests();
+                if (r != 0)
+                    return r;
+                continue;
+            }
+
+            if (ievent->len == 0)
+                continue;
+
+            if (ievent->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+                int r = add_request(ievent->name);
+                if (r != 0)
+                    return r;
+            } else if (ievent->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                remove_request(ievent->name);
+            }
+        }
+    }
+}
 
-    ssize_t block_size = read(fd_inotify, buffer, buffer_size);
-    if (block_size < 0) {
+int process_signal()
+{
+    struct signalfd_siginfo info;
+    if (read(fd_signal, &info, sizeof(info)) != sizeof(info)) {
         int ret = errno;
         perror("read() is failed");
         return ret;
     }
 
-    assert((size_t) block_size == buffer_size);
+    fprintf(stderr, "Received signal %u, exiting\n", info.ssi_signo);
+    terminated = true;
+    return 0;
+}
 
-    struct inotify_event* ievent1 = (struct inotify_event*) buffer;
-    struct inotify_event* ievent2 = ievent1 + 1;
+int set_timer(uint64_t usec)
+{
+    /* Zero disarms the timer */
+    struct itimerspec spec;
+    spec.it_interval.tv_sec = 0;
+    spec.it_interval.tv_nsec = 0;
+    spec.it_value.tv_sec = usec / 1000000;
+    spec.it_value.tv_nsec = (usec % 1000000) * 1000;
 
-    assert(ievent1->mask & IN_DELETE_SELF);
-    assert(ievent2->mask & IN_IGNORED);
-    UNUSED(ievent2);
+    if (timerfd_settime(fd_timer, TFD_TIMER_ABSTIME, &spec, NULL) == -1) {
+        int ret = errno;
+        perror("timerfd_settime() is failed");
+        return ret;
+    }
 
-    assert(read(fd_inotify, buffer, buffer_size) == -1 && errno == EAGAIN); // no more events
     return 0;
 }
 
-void sigalarm(int signo, siginfo_t *info, void *context)
+int receive_reply(struct Secret* ret_reply)
 {
-    assert(signo == SIGALRM);
-    UNUSED(signo);
-    UNUSED(context);
+    ssize_t size = recv(fd_session, NULL, 0, MSG_PEEK | MSG_TRUNC);
+    if (size < 0) {
+        int ret = errno;
+        perror("recv() is failed");
+        return ret;
+    }
+    if (size == 0) {
+        fprintf(stderr, "unl0kr closed the session\n");
+        return EPIPE;
+    }
 
-    if (info->si_code == SI_TIMER) {
-        assert(info->si_value.sival_ptr == &id_timer);
-        timer_expired = true;
+    /* Receive the reply straight into the buffer it is forwarded from */
+    struct Secret reply;
+    int r = Secret_alloc(&reply, size);
+    if (r != 0) {
+        recv(fd_session, NULL, 0, 0); /* Drop the reply */
+        return r;
     }
 
-    switch (timer_action) {
-    case TERMINATE_UNL0KR:
-        if (kill(pid_unl0kr, SIGTERM) == 0) {
-            struct itimerspec spec;
-            spec.it_interval.tv_sec = 0;
-            spec.it_interval.tv_nsec = 0;
-            spec.it_value.tv_sec = 5;
-            spec.it_value.tv_nsec = 0;
-            timer_settime(id_timer, 0, &spec, NULL);
-            timer_action = KILL_UNL0KR;
-        }
-        break;
-    case KILL_UNL0KR:
-        kill(pid_unl0kr, SIGKILL);
-        break;
-    default:
-        break;
+    size = recv(fd_session, reply.data, reply.capacity, 0);
+    if (size <= 0) {
+        int ret = size < 0 ? errno : EPIPE;
+        perror("recv() is failed");
+        Secret_free(&reply);
+        return ret;
     }
+    reply.size = size;
+
+    *ret_reply = reply;
+    return 0;
 }
 
-void sigchild(int signo, siginfo_t *info, void *context)
+int cancel_prompt()
 {
-    assert(signo == SIGCHLD);
-    UNUSED(signo);
-    UNUSED(context);
-
-    if (pid_unl0kr == 0)
-        return;
+    const char command = UL_SESSION_CANCEL;
+    if (send(fd_session, &command, 1, MSG_NOSIGNAL) < 0) {
+        int ret = errno;
+        perror("send() is failed");
+        return ret;
+    }
 
-    assert(info->si_pid == pid_unl0kr);
+    /* unl0kr answers every prompt exactly once. Consume the answer, which is either
+       the acknowledgement or a password that was entered in the meantime. */
+    struct Secret reply;
+    int r = receive_reply(&reply);
+    if (r != 0)
+        return r;
 
-    if (info->si_code == CLD_EXITED ||
-        info->si_code == CLD_KILLED ||
-        info->si_code == CLD_DUMPED ) {
-        unl0kr_exited = true;
-    }
+    Secret_free(&reply);
+    return 0;
 }
 
-int event_loop(pid_t pid)
+int event_loop(struct Secret* ret_reply)
 {
     int ret = 0;
     int r;
 
-    if (request.not_after != 0) {
-        struct itimerspec spec;
-        spec.it_interval.tv_sec = 0;
-        spec.it_interval.tv_nsec = 0;
-        spec.it_value.tv_sec = request.not_after / 1000000;
-        spec.it_value.tv_nsec = (request.not_after % 1000000) * 1000;
-        r = timer_settime(id_timer, TIMER_ABSTIME, &spec, NULL);
-        if (r == -1)
-            perror("timer_settime() is failed");
-    }
-
-    struct epoll_event event;
-    pid_unl0kr = pid;
-    timer_action = TERMINATE_UNL0KR;
-    timer_expired = false;
-    unl0kr_exited = false;
-
-    sigset_t sigmask;
-    sigemptyset(&sigmask);
+    if (request->not_after != 0)
+        set_timer(request->not_after);
 
     for (;;) {
-        r = epoll_pwait(fd_epoll, &event, 1, -1, &sigmask);
+        struct epoll_event event;
+        r = epoll_wait(fd_epoll, &event, 1, -1);
         if (r == -1) {
-            if (errno != EINTR) {
-                ret = errno;
-                perror("epoll_pwait() is failed");
-                break;
-            }
-
-            if (unl0kr_exited)
-                break;
-
-            if (timer_expired && ret != ECANCELED) {
-                ret = ETIME;
-                fprintf(stderr, "The request has expired\n");
-            }
+            if (errno == EINTR)
+                continue;
+            ret = errno;
+            perror("epoll_wait() is failed");
+            break;
+        }
 
-            continue;
+        if (event.data.fd == fd_session) {
+            ret = receive_reply(ret_reply);
+            break;
         }
 
-        r = process_inotify_events();
-        if (r != 0) {
-            ret = errno;
+        if (event.data.fd == fd_pidfd) {
+            ret = ECHILD;
+            fprintf(stderr, "unl0kr exited unexpectedly\n");
             break;
         }
 
-        ret = ECANCELED;
-        fprintf(stderr, "The request was cancelled\n");
+        if (event.data.fd == fd_signal) {
+            r = process_signal();
+            ret = r != 0 ? r : ECANCELED;
+        } else if (event.data.fd == fd_timer) {
+            uint64_t expirations;
+            if (read(fd_timer, &expirations, sizeof(expirations)) == -1 && errno == EAGAIN)
+                continue;
 
-        if (timer_expired)
-            continue;
+            ret = ETIME;
+            fprintf(stderr, "The request has expired\n");
+        } else {
+            r = process_inotify_events();
+            if (r != 0) {
+                ret = r;
+                break;
+            }
 
-        if (request.not_after != 0) {
-            struct itimerspec spec;
-            spec.it_interval.tv_sec = 0;
-            spec.it_interval.tv_nsec = 0;
-            spec.it_value.tv_sec = 0;
-            spec.it_value.tv_nsec = 0;
-            r = timer_settime(id_timer, 0, &spec, NULL);
-            if (r == -1)
-                perror("Disarming the timer is failed");
-        }
+            /* Other requests may come and go while this one is being prompted for */
+            if (!request->removed)
+                continue;
 
-        r = raise(SIGALRM);
-        if (r != 0) {
-            ret = errno;
-            perror("raise() is failed");
-            break;
+            ret = ECANCELED;
+            fprintf(stderr, "The request was cancelled\n");
         }
+
+        r = cancel_prompt();
+        if (r != 0)
+            ret = r;
+        break;
     }
 
-    timer_action = NO_ACTION;
-    pid_unl0kr = 0;
+    set_timer(0);
+    return ret;
+}
 
-    /* Stop the timer unconditionally because it can be armed by sigalarm() */
-    struct itimerspec spec;
-    spec.it_interval.tv_sec = 0;
-    spec.it_interval.tv_nsec = 0;
-    spec.it_value.tv_sec = 0;
-    spec.it_value.tv_nsec = 0;
-    r = timer_settime(id_timer, 0, &spec, NULL);
-    if (r == -1)
-        perror("Disarming the timer is failed");
+void stop_unl0kr_session()
+{
+    if (pid_session == 0)
+        return;
 
-    return ret;
+    /* unl0kr exits once the session is closed */
+    close(fd_session);
+    fd_session = -1;
+    close(fd_pidfd);
+    fd_pidfd = -1;
+
+    while (waitpid(pid_session, NULL, 0) == -1) {
+        if (errno != EINTR) {
+            perror("waitpid() is failed");
+            break;
+        }
+    }
+    pid_session = 0;
 }
 
-int exec_unl0kr(char** ret_password)
+int start_unl0kr_session()
 {
     int ret = 0;
-    int r;
 
-    int fd_pipe[2];
-    if (pipe(fd_pipe) != 0) {
+    int fd_pair[2];
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET|SOCK_CLOEXEC, 0, fd_pair) != 0) {
         ret = errno;
-        perror("Can't create a pipe");
+        perror("Can't create a socket pair");
         return ret;
     }
 
-    sigset_t used_signals;
-    sigemptyset(&used_signals);
-    sigaddset(&used_signals, SIGCHLD);
-    sigaddset(&used_signals, SIGALRM);
-
-    r = sigprocmask(SIG_BLOCK, &used_signals, NULL);
-    if (r == -1) {
-        ret = errno;
-        perror("sigprocmask(SIG_BLOCK) is failed");
-        goto exit1;
-    }
+    /* Don't wait forever for unl0kr to acknowledge a cancellation */
+    struct timeval timeout;
+    timeout.tv_sec = 5;
+    timeout.tv_usec = 0;
+    if (setsockopt(fd_pair[0], SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) != 0)
+        perror("setsockopt(SO_RCVTIMEO) is failed");
 
     pid_t pid = fork();
     if (pid == -1) {
         ret = errno;
         perror("fork() is failed");
-        goto exit2;
+        close(fd_pair[0]);
+        close(fd_pair[1]);
+        return ret;
     }
     if (pid == 0) {
         /* Child */
-        close(fd_pipe[0]);
-
-        if (dup2(fd_pipe[1], STDOUT_FILENO) == -1) {
-            perror("dup2() is failed");
+        close(fd_pair[0]);
+
+        /* The signal mask survives exec, don't leave unl0kr deaf to termination */
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGTERM);
+        sigaddset(&signals, SIGINT);
+        sigprocmask(SIG_UNBLOCK, &signals, NULL);
+
+        /* Pass the session socket through exec */
+        if (fcntl(fd_pair[1], F_SETFD, 0) == -1) {
+            perror("fcntl() is failed");
             exit(EXIT_FAILURE);
         }
 
-        char* argv[5];
-        int argc = 2;
-        argv[0] = UNL0KR_BINARY;
-        argv[1] = "-n";
-        if (request.message) {
-            argv[2] = "-m";
-            argv[3] = request.message;
-            argc += 2;
-        }
-        argv[argc] = NULL;
+        char fd_string[16];
+        snprintf(fd_string, sizeof(fd_string), "%d", fd_pair[1]);
 
+        char* argv[] = { UNL0KR_BINARY, "-s", fd_string, NULL };
         execv(UNL0KR_BINARY, argv);
 
         perror("exec() is failed");
@@ -444,86 +645,360 @@ int exec_unl0kr(char** ret_password)
     }
 
     /* Parent */
-    r = event_loop(pid);
+    close(fd_pair[1]);
 
-    int status;
-    if (waitpid(pid, &status, 0) == -1) {
+    /* Track the child through a file descriptor instead of SIGCHLD */
+    int fd = syscall(SYS_pidfd_open, pid, 0);
+    if (fd == -1) {
         ret = errno;
-        perror("waitpid() is failed");
-        goto exit2;
+        perror("pidfd_open() is failed");
+        close(fd_pair[0]);
+        kill(pid, SIGKILL);
+        waitpid(pid, NULL, 0);
+        return ret;
     }
 
+    fd_session = fd_pair[0];
+    fd_pidfd = fd;
+    pid_session = pid;
+    return 0;
+}
+
+int send_prompt()
+{
+    const size_t message_length = request->message ? strlen(request->message) : 0;
+    char prompt[1 + message_length];
+    prompt[0] = UL_SESSION_PROMPT;
+    if (message_length != 0)
+        memcpy(prompt + 1, request->message, message_length);
+
+    if (send(fd_session, prompt, sizeof(prompt), MSG_NOSIGNAL) < 0) {
+        int ret = errno;
+        perror("send() is failed");
+        return ret;
+    }
+
+    return 0;
+}
+
+int watch_session(int op)
+{
+    /* Only watch the session while a prompt is pending */
+    struct epoll_event epevent_session;
+    epevent_session.events = EPOLLIN;
+    epevent_session.data.fd = fd_session;
+
+    struct epoll_event epevent_pidfd;
+    epevent_pidfd.events = EPOLLIN;
+    epevent_pidfd.data.fd = fd_pidfd;
+
+    if (epoll_ctl(fd_epoll, op, fd_session, &epevent_session) == -1 ||
+        epoll_ctl(fd_epoll, op, fd_pidfd, &epevent_pidfd) == -1) {
+        int ret = errno;
+        perror("epoll_ctl() is failed");
+        return ret;
+    }
+
+    return 0;
+}
+
+int prompt_unl0kr(struct Secret* ret_password)
+{
+    int ret = 0;
+    int r;
+
+    /* Replace an instance that has exited since the last request */
+    if (pid_session != 0 && waitpid(pid_session, NULL, WNOHANG) == pid_session) {
+        fprintf(stderr, "unl0kr exited since the last request, restarting\n");
+        close(fd_session);
+        fd_session = -1;
+        close(fd_pidfd);
+        fd_pidfd = -1;
+        pid_session = 0;
+    }
+
+    if (pid_session == 0) {
+        r = start_unl0kr_session();
+        if (r != 0)
+            return r;
+    }
+
+    r = send_prompt();
     if (r != 0) {
         ret = r;
-        goto exit2;
+        goto exit1;
+    }
+
+    r = watch_session(EPOLL_CTL_ADD);
+    if (r != 0) {
+        ret = r;
+        /* Don't leave one of the descriptors behind */
+        epoll_ctl(fd_epoll, EPOLL_CTL_DEL, fd_session, NULL);
+        goto exit1;
     }
 
-    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    struct Secret reply;
+    r = event_loop(&reply);
+
+    watch_session(EPOLL_CTL_DEL);
+
+    if (r != 0) {
+        ret = r;
+        goto exit1;
+    }
+
+    if (reply.data[0] != '+') {
         ret = ECHILD;
-        fprintf(stderr, "unl0kr is failed\n");
-        goto exit2;
+        fprintf(stderr, "unl0kr sent an unexpected reply\n");
+        Secret_free(&reply);
+        goto exit1;
     }
 
-    int password_size;
-    if (ioctl(fd_pipe[0], FIONREAD, &password_size) == -1) {
-        ret = errno;
-        perror("ioctl() is failed");
-        goto exit2;
+    /* The reply is already in the format expected by systemd */
+    *ret_password = reply;
+exit1:
+    if (ret != 0 && ret != ECANCELED && ret != ETIME) {
+        /* The session is in an unknown state, start over with the next request */
+        kill(pid_session, SIGKILL);
+        stop_unl0kr_session();
+    } else if (!persistent || terminated) {
+        stop_unl0kr_session();
     }
 
-    char* password = malloc(1 + password_size + 1);
-    if (!password) {
-        ret = ENOMEM;
-        fprintf(stderr, "Out of memory\n");
-        goto exit2;
+    return ret;
+}
+
+void mark_answered(struct Request* req)
+{
+    req->answered_at = now_usec();
+}
+
+void answer_cached_requests()
+{
+    if (!cached_password.data)
+        return;
+
+    if (now_usec() >= cached_at + CACHE_TIMEOUT) {
+        Secret_free(&cached_password);
+        return;
     }
 
-    password[0] = '+';
-    if (password_size != 0) {
-        password_size = read(fd_pipe[0], password + 1, password_size);
-        if (password_size == -1) {
-            ret = errno;
-            perror("read() is failed");
-            free(password);
-            goto exit2;
+    for (size_t i = 0; i < queue_length; i++) {
+        struct Request* req = queue[i];
+        if (req->answered_at != 0 || !req->accept_cached || !req->socket)
+            continue;
+
+        fprintf(stderr, "Answering '%s' with the cached password\n", req->file);
+        send_password(req, cached_password.data, cached_password.size);
+        mark_answered(req);
+    }
+}
+
+int handle_request(struct Request* req)
+{
+    int ret = 0;
+    int r;
+
+    if (req->pid != 0) {
+        r = kill(req->pid, 0);
+        if (r == -1 && errno == ESRCH) {
+            fprintf(stderr, "The file '%s' contains invalid PID, removing.\n", req->file);
+            remove(req->file);
+            mark_answered(req);
+            return 0;
         }
     }
-    password[1 + password_size] = 0;
 
-    *ret_password = password;
-exit2:
-    r = sigprocmask(SIG_UNBLOCK, &used_signals, NULL);
-    if (r == -1)
-        perror("sigprocmask(SIG_UNBLOCK) is failed");
-exit1:
-    close(fd_pipe[0]);
-    close(fd_pipe[1]);
+    if (!req->socket) {
+        fprintf(stderr, "The file '%s' doesn't contain a socket, waiting for removal.\n", req->file);
+        mark_answered(req);
+        return 0;
+    }
+
+    if (req->not_after != 0 && req->not_after <= now_usec()) {
+        fprintf(stderr, "The request '%s' expired, waiting for removal.\n", req->file);
+        mark_answered(req);
+        return 0;
+    }
+
+    request = req;
+
+    struct Secret password;
+    r = prompt_unl0kr(&password);
+
+    if (r == 0) {
+        mark_answered(req);
+        ret = send_password(req, password.data, password.size);
+
+        /* Keep the password to answer requests that accept a cached one */
+        Secret_free(&cached_password);
+        cached_password = password;
+        cached_at = now_usec();
+    } else if (r == ETIME) {
+        mark_answered(req);
+        send_password(req, "-", 1);
+    } else if (r != ECANCELED) {
+        ret = r;
+    }
+
+    request = NULL;
+
+    size_t index;
+    if (req->removed && find_request(req->name, &index))
+        drop_request(index);
+
     return ret;
 }
 
-int wait_for_file_removed()
+void start_standby_session()
 {
-    struct epoll_event event;
+    /* Have the next instance ready by the time another request arrives. A failure is not fatal,
+       the session is started again for the next prompt. */
+    if (standby && pid_session == 0)
+        start_unl0kr_session();
+}
+
+int wait_for_event(uint64_t deadline)
+{
+    /* A zero deadline waits without a timeout */
+    int r = set_timer(deadline);
+    if (r != 0)
+        return r;
 
-    int r = epoll_wait(fd_epoll, &event, 1, 20000);
+    struct epoll_event event;
+    r = epoll_wait(fd_epoll, &event, 1, -1);
     if (r == -1) {
-        int ret = errno;
-        perror("epoll_wait() is failed");
+        int ret = errno == EINTR ? 0 : errno;
+        if (ret != 0)
+            perror("epoll_wait() is failed");
+        set_timer(0);
         return ret;
-    } else if (r == 0) {
-        fprintf(stderr, "The file '%s' was not removed as expected, exiting.\n", request.file);
-        return ETIME;
+    }
+
+    set_timer(0);
+
+    if (event.data.fd == fd_signal)
+        return process_signal();
+    if (event.data.fd == fd_timer) {
+        /* The deadline is checked again on the next iteration */
+        uint64_t expirations;
+        if (read(fd_timer, &expirations, sizeof(expirations)) == -1 && errno != EAGAIN)
+            perror("read() is failed");
+        return 0;
     }
 
     return process_inotify_events();
 }
 
-int main()
+int wait_for_requests()
+{
+    /* Only answered requests are left, give their owners some time to remove them */
+    uint64_t oldest = UINT64_MAX;
+    const char* oldest_file = NULL;
+    for (size_t i = 0; i < queue_length; i++) {
+        if (queue[i]->answered_at < oldest) {
+            oldest = queue[i]->answered_at;
+            oldest_file = queue[i]->file;
+        }
+    }
+
+    const uint64_t now = now_usec();
+    if (now >= oldest + REMOVAL_TIMEOUT) {
+        fprintf(stderr, "The file '%s' was not removed as expected, exiting.\n", oldest_file);
+        return ETIME;
+    }
+
+    start_standby_session();
+    return wait_for_event(oldest + REMOVAL_TIMEOUT);
+}
+
+int wait_idle(uint64_t idle_until)
+{
+    /* The queue is empty, keep the warm unl0kr around for requests that follow shortly */
+    if (idle_until != 0 && now_usec() >= idle_until) {
+        fprintf(stderr, "No new requests arrived, exiting.\n");
+        return ETIME;
+    }
+
+    start_standby_session();
+    return wait_for_event(idle_until);
+}
+
+int add_to_epoll(int fd, uint32_t events)
+{
+    struct epoll_event event;
+    event.events = events;
+    event.data.fd = fd;
+
+    if (epoll_ctl(fd_epoll, EPOLL_CTL_ADD, fd, &event) == -1) {
+        int ret = errno;
+        perror("epoll_ctl() is failed");
+        return ret;
+    }
+
+    return 0;
+}
+
+void print_usage()
+{
+    fprintf(stderr,
+        "Usage: unl0kr-agent [OPTION]\n"
+        "\n"
+        "Answer systemd password requests with unl0kr.\n"
+        "\n"
+        "  -p, --persistent  Keep a single unl0kr running for consecutive requests\n"
+        "  -s, --standby     Start unl0kr ahead of requests so that prompts show up\n"
+        "                    without its startup delay\n"
+        "  -i, --idle-timeout=SECONDS\n"
+        "                    With --persistent or --standby, keep waiting for new\n"
+        "                    requests for this long once all requests are handled\n"
+        "                    (default: 30, 0 waits until the agent is stopped)\n"
+        "  -h, --help        Print this message and exit\n");
+}
+
+int main(int argc, char* argv[])
 {
     int exit_code = EXIT_SUCCESS;
     int r;
 
-    Request_init(&request);
+    struct option long_opts[] = {
+        { "persistent",   no_argument,       NULL, 'p' },
+        { "standby",      no_argument,       NULL, 's' },
+        { "idle-timeout", required_argument, NULL, 'i' },
+        { "help",         no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "psi:h", long_opts, NULL)) != -1) {
+        switch (opt) {
+        case 'p':
+            persistent = true;
+            break;
+        case 's':
+            standby = true;
+            break;
+        case 'i': {
+            char* end;
+            errno = 0;
+            unsigned long seconds = strtoul(optarg, &end, 10);
+            if (errno != 0 || *end != 0 || optarg[0] == 0 || optarg[0] == '-' ||
+                seconds > UINT64_MAX / 1000000) {
+                fprintf(stderr, "Invalid idle timeout '%s'\n", optarg);
+                print_usage();
+                return EXIT_FAILURE;
+            }
+            idle_timeout = (uint64_t) seconds * 1000000;
+            break;
+        }
+        case 'h':
+            print_usage();
+            return EXIT_SUCCESS;
+        default:
+            print_usage();
+            return EXIT_FAILURE;
+        }
+    }
 
     fd_epoll = epoll_create1(EPOLL_CLOEXEC);
     if (fd_epoll == -1) {
@@ -539,147 +1014,139 @@ int main()
         goto exit2;
     }
 
-    struct epoll_event epevent_inotify;
-    epevent_inotify.events = EPOLLIN|EPOLLET;
-    epevent_inotify.data.fd = fd_inotify;
-
-    r = epoll_ctl(fd_epoll, EPOLL_CTL_ADD, fd_inotify, &epevent_inotify);
-    if (r == -1) {
-        perror("epoll_ctl() is failed");
+    r = add_to_epoll(fd_inotify, EPOLLIN|EPOLLET);
+    if (r != 0) {
         exit_code = EXIT_FAILURE;
         goto exit3;
     }
 
-    struct sigevent sigevent_timer;
-    sigevent_timer.sigev_notify = SIGEV_SIGNAL;
-    sigevent_timer.sigev_signo = SIGALRM;
-    sigevent_timer.sigev_value.sival_ptr = &id_timer;
+    /* Handle termination requests in the event loop instead of a signal handler */
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGTERM);
+    sigaddset(&signals, SIGINT);
 
-    r = timer_create(CLOCK_MONOTONIC, &sigevent_timer, &id_timer);
+    r = sigprocmask(SIG_BLOCK, &signals, NULL);
     if (r == -1) {
-        perror("timer_create() is failed");
+        perror("sigprocmask(SIG_BLOCK) is failed");
         exit_code = EXIT_FAILURE;
         goto exit3;
     }
 
-    struct sigaction sigaction_alarm;
-    sigaction_alarm.sa_sigaction = sigalarm;
-    sigaction_alarm.sa_flags = SA_SIGINFO;
-    sigemptyset(&sigaction_alarm.sa_mask);
-    sigaddset(&sigaction_alarm.sa_mask, SIGCHLD);
+    fd_signal = signalfd(-1, &signals, SFD_NONBLOCK|SFD_CLOEXEC);
+    if (fd_signal == -1) {
+        perror("signalfd() is failed");
+        exit_code = EXIT_FAILURE;
+        goto exit3;
+    }
 
-    r = sigaction(SIGALRM, &sigaction_alarm, NULL);
-    if (r == -1) {
-        perror("sigaction() for SIGALRM is failed");
+    r = add_to_epoll(fd_signal, EPOLLIN);
+    if (r != 0) {
         exit_code = EXIT_FAILURE;
         goto exit4;
     }
 
-    struct sigaction sigaction_child;
-    sigaction_child.sa_sigaction = sigchild;
-    sigaction_child.sa_flags = SA_SIGINFO | SA_NOCLDSTOP;
-    sigemptyset(&sigaction_child.sa_mask);
-    sigaddset(&sigaction_child.sa_mask, SIGALRM);
-
-    r = sigaction(SIGCHLD, &sigaction_child, NULL);
-    if (r == -1) {
-        perror("sigaction() for SIGCHLD is failed");
+    fd_timer = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK|TFD_CLOEXEC);
+    if (fd_timer == -1) {
+        perror("timerfd_create() is failed");
         exit_code = EXIT_FAILURE;
         goto exit4;
     }
 
-    for (;;) {
-        char* file;
-        r = find_request(&file);
-        if (r != 0) {
-            if (r != ENOENT)
-                exit_code = EXIT_FAILURE;
-            break;
-        }
+    r = add_to_epoll(fd_timer, EPOLLIN);
+    if (r != 0) {
+        exit_code = EXIT_FAILURE;
+        goto exit5;
+    }
 
-        int wd_inotify = inotify_add_watch(fd_inotify, file, IN_DELETE_SELF | IN_DONT_FOLLOW);
-        if (wd_inotify == -1) {
-            fprintf(stderr, "inotify_add_watch() is failed for '%s': %s\n", file, strerror(errno));
-            free(file);
+    r = inotify_add_watch(fd_inotify, ASK_FOLDER, IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE | IN_MOVED_FROM | IN_ONLYDIR);
+    if (r == -1) {
+        if (errno != ENOENT) {
+            fprintf(stderr, "inotify_add_watch() is failed for '%s': %s\n", ASK_FOLDER, strerror(errno));
             exit_code = EXIT_FAILURE;
-            break;
         }
+        goto exit5;
+    }
 
-        Request_reset(&request);
-        request.file = file;
-
-        r = ini_parse(file, ini_parser, &request);
-        if (r < 0) {
-            fprintf(stderr, "The file '%s' can't be parsed: %d\n", request.file, r);
+    /* Let unl0kr initialise while the requests are being read */
+    if (standby) {
+        r = start_unl0kr_session();
+        if (r != 0) {
             exit_code = EXIT_FAILURE;
-            break;
+            goto exit5;
         }
+    }
 
-        if (request.pid != 0) {
-            r = kill(request.pid, 0);
-            if (r == -1 && errno == ESRCH) {
-                fprintf(stderr, "The file '%s' contains invalid PID, removing.\n", request.file);
-                remove(request.file);
-                goto loop1;
-            }
-        }
+    /* Pick up requests that were created before the watch */
+    r = scan_requests();
+    if (r != 0) {
+        exit_code = EXIT_FAILURE;
+        goto exit5;
+    }
 
-        if (!request.socket) {
-            fprintf(stderr, "The file '%s' doesn't contain a socket, waiting for removal.\n", request.file);
-            goto loop1;
-        }
+    /* Set once the queue became empty, zero when idling without a deadline */
+    bool idle = false;
+    uint64_t idle_until = 0;
 
-        if (request.not_after != 0) {
-            struct timespec ts;
-            r = clock_gettime(CLOCK_MONOTONIC, &ts);
-            if (r == -1) {
-                perror("clock_gettime() is failed");
-                exit_code = EXIT_FAILURE;
+    while (!terminated) {
+        if (queue_length == 0) {
+            /* Without a warm unl0kr to keep around, there is nothing left to do */
+            if (!persistent && !standby)
                 break;
+
+            /* Don't keep the password around while idling, requests that follow later are prompted for */
+            Secret_free(&cached_password);
+
+            if (!idle) {
+                idle = true;
+                idle_until = idle_timeout != 0 ? now_usec() + idle_timeout : 0;
             }
-            uint64_t now = ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
-            if (request.not_after <= now) {
-                fprintf(stderr, "The request '%s' expired, waiting for removal.\n", request.file);
-                goto loop1;
-            }
-        }
 
-        char* password;
-        r = exec_unl0kr(&password);
-        if (r != 0) {
-            if (r == ECANCELED)
-                continue;
-            else if (r == ETIME) {
-                send_password("-");
-                goto loop1;
-            } else {
+            r = wait_idle(idle_until);
+            if (r == ETIME)
+                break;
+            if (r != 0) {
                 exit_code = EXIT_FAILURE;
                 break;
             }
+            continue;
         }
+        idle = false;
 
-        r = send_password(password);
-        erase_and_free(password);
-        if (r != 0) {
-            exit_code = EXIT_FAILURE;
-            break;
+        answer_cached_requests();
+
+        struct Request* next = NULL;
+        for (size_t i = 0; i < queue_length; i++) {
+            if (queue[i]->answered_at == 0) {
+                next = queue[i];
+                break;
+            }
         }
 
-loop1:
-        r = wait_for_file_removed();
+        if (next)
+            r = handle_request(next);
+        else
+            r = wait_for_requests();
+
         if (r != 0) {
             exit_code = EXIT_FAILURE;
             break;
         }
     }
 
+exit5:
+    stop_unl0kr_session();
+    close(fd_timer);
 exit4:
-    timer_delete(id_timer);
+    close(fd_signal);
 exit3:
     close(fd_inotify);
 exit2:
     close(fd_epoll);
 exit1:
-    Request_free(&request);
+    while (queue_length != 0)
+        drop_request(queue_length - 1);
+    free(queue);
+    Secret_free(&cached_password);
     return exit_code;
 }